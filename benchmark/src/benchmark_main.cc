@@ -20,6 +20,8 @@
 #include "bitlib/bitlib.hpp"
 //#include "utils/test_utils.hpp"
 #include "count_bench.hpp"
+#include "rank_select_bench.hpp"
+#include "set_bits_bench.hpp"
 #include "rotate_bench.hpp"
 #include "reverse_bench.hpp"
 #include "fill_bench.hpp"
@@ -334,6 +336,11 @@ int main(int argc, char** argv) {
             BM_BoolRotate, 
             "std::rotate (large)",
             size_large);
+    benchmark::RegisterBenchmark(
+            "bit::rotate sweep (large)",
+            BM_BitRotateSweep,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large))
+        ->Arg(0)->Arg(1)->Arg(4)->Arg(16)->Arg(32)->Arg(48)->Arg(60)->Arg(63);
 
     // Count benchmarks 
     register_word_containers<decltype(BM_BitCount), std::vector>(
@@ -368,6 +375,71 @@ int main(int argc, char** argv) {
             BM_BoolCount, 
             "std::count (large)",
             size_large);
+    register_word_containers<decltype(BM_LibPopcntCount), std::vector>(
+            BM_LibPopcntCount, 
+            "libpopcnt (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitCountUnaligned), std::vector>(
+            BM_BitCountUnaligned, 
+            "bit::count (large) (UU)",
+            size_large);
+    register_word_containers<decltype(BM_BitCount), std::vector>(
+            BM_BitCount, 
+            "bit::count (huge)",
+            size_huge);
+    register_word_containers<decltype(BM_LibPopcntCount), std::vector>(
+            BM_LibPopcntCount, 
+            "libpopcnt (huge)",
+            size_huge);
+    register_word_containers<decltype(BM_BitCountUnaligned), std::vector>(
+            BM_BitCountUnaligned, 
+            "bit::count (huge) (UU)",
+            size_huge);
+
+    register_word_containers<decltype(BM_BitCountXor), std::vector>(
+            BM_BitCountXor, 
+            "bit::count_xor (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitCountXorUnaligned), std::vector>(
+            BM_BitCountXorUnaligned, 
+            "bit::count_xor (large) (UU)",
+            size_large);
+    register_word_containers<decltype(BM_BitTransformCountXor), std::vector>(
+            BM_BitTransformCountXor, 
+            "bit::transform + bit::count xor (large)",
+            size_large);
+
+    // rank/select benchmarks
+    register_word_containers<decltype(BM_BitRankSelectRank), std::vector>(
+            BM_BitRankSelectRank, 
+            "bit::rank_select::rank (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitCountRank), std::vector>(
+            BM_BitCountRank, 
+            "bit::count rank (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitRankSelectSelect), std::vector>(
+            BM_BitRankSelectSelect, 
+            "bit::rank_select::select (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitRankSelectBuild), std::vector>(
+            BM_BitRankSelectBuild, 
+            "bit::rank_select (build) (large)",
+            size_large);
+
+    // set bit enumeration benchmarks
+    register_word_containers<decltype(BM_BitForEachSetBit), std::vector>(
+            BM_BitForEachSetBit, 
+            "bit::for_each_set_bit (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitSetBitsView), std::vector>(
+            BM_BitSetBitsView, 
+            "bit::set_bits (large)",
+            size_large);
+    register_word_containers<decltype(BM_BitFindSetBits), std::vector>(
+            BM_BitFindSetBits, 
+            "bit::find set bits (large)",
+            size_large);
 
     // swap_ranges benchmarks
     register_word_containers<decltype(BM_BitSwapRangesAA), std::vector>(
@@ -408,6 +480,10 @@ int main(int argc, char** argv) {
             BM_BitCopy, 
             "bit::copy (large) (UU)",
             size_large);
+    register_word_containers<decltype(BM_BitCopyAA), std::vector>(
+            BM_BitCopyAA,
+            "bit::copy (large) (AA)",
+            size_large);
     register_bool_containers<decltype(BM_BoolCopy), std::vector>(
             BM_BoolCopy, 
             "std::copy (large)",
@@ -522,6 +598,10 @@ int main(int argc, char** argv) {
             BM_BitFind, 
             "bit::find (large) (UU)",
             size_large);
+    register_word_containers<decltype(BM_BitFindLast), std::vector>(
+            BM_BitFindLast,
+            "bit::find_last (large) (UU)",
+            size_large);
     register_word_containers<decltype(BM_DynamicBitsetFind), std::vector>(
             BM_DynamicBitsetFind, 
             "dynamic_bitset::find (large)",
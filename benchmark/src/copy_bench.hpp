@@ -26,6 +26,24 @@ auto BM_BitCopy = [](benchmark::State& state, auto input) {
         );
 };
 
+// Word aligned source and destination: the baseline for the (UU) case
+auto BM_BitCopyAA = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<WordType>::value;
+    auto container_size = total_bits / digits + 1;
+    auto bitvec1 = get_random_vec<WordType>(container_size);
+    auto first1 = bit::bit_iterator<decltype(std::begin(bitvec1))>(std::begin(bitvec1));
+    auto bitvec2 = get_random_vec<WordType>(container_size);
+    auto first2 = bit::bit_iterator<decltype(std::begin(bitvec2))>(std::begin(bitvec2));
+
+    for (auto _ : state)
+        bit::copy(
+            first1,
+            first1 + total_bits,
+            first2
+        );
+};
 
 auto BM_BoolCopy = [](benchmark::State& state, auto input) {
     using container_type = typename std::tuple_element<0, decltype(input)>::type;
@@ -4,6 +4,8 @@
 #include "benchmark_utils.hpp"
 #include "bit_array.h"
 #include "bitlib/bit-algorithms/count.hpp"
+#include "bitlib/bit-algorithms/transform.hpp"
+#include "bitlib/bit-algorithms/transform_count.hpp"
 #include "sul/dynamic_bitset.hpp"
 
 auto BM_BitCount = [](benchmark::State& state, auto input) {
@@ -21,6 +23,79 @@ auto BM_BitCount = [](benchmark::State& state, auto input) {
     }
 };
 
+// Baseline: the raw libpopcnt kernel over the same words, without the
+// bit_iterator head/tail handling
+auto BM_LibPopcntCount = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(popcnt(bitcont.data(), bitcont.size() * sizeof(word_type)));
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitCountUnaligned = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont)) + 3;
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont)) - 5;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::count(first, last, bit::bit1));
+        benchmark::ClobberMemory();
+    }
+};
+
+// Hamming distance in one pass; offset shifts the second range off word alignment
+auto BM_BitCountXor = [](benchmark::State& state, auto input, std::size_t offset = 0) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont1 = make_random_container<container_type>(container_size);
+    container_type bitcont2 = make_random_container<container_type>(container_size + 1);
+    auto first1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto last1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto first2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2)) + offset;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::count_xor(first1, last1, first2));
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitCountXorUnaligned = [](benchmark::State& state, auto input) {
+    BM_BitCountXor(state, input, 3);
+};
+
+// Baseline: xor into a temporary, then count it
+auto BM_BitTransformCountXor = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont1 = make_random_container<container_type>(container_size);
+    container_type bitcont2 = make_random_container<container_type>(container_size);
+    container_type temp(container_size);
+    auto first1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto last1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto first2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+    auto d_first = bit::bit_iterator<decltype(std::begin(temp))>(std::begin(temp));
+    for (auto _ : state) {
+        auto d_last = bit::transform(first1, last1, first2, d_first,
+                                     [](word_type a, word_type b) -> word_type { return a ^ b; });
+        benchmark::DoNotOptimize(bit::count(d_first, d_last, bit::bit1));
+        benchmark::ClobberMemory();
+    }
+};
 
 auto BM_BitArrayCount = [](benchmark::State& state, auto input) {
     using container_type = typename std::tuple_element<0, decltype(input)>::type;
@@ -20,6 +20,22 @@ auto BM_BitFind = [](benchmark::State& state, auto input) {
     }
 };
 
+auto BM_BitFindLast = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    *(first + total_bits / 2 - 4) = bit::bit1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::find_last(first + 2, last - 3, bit::bit1));
+        benchmark::ClobberMemory();
+    }
+};
+
 auto BM_BitArrayFind = [](benchmark::State& state, auto input) {
     using container_type = typename std::tuple_element<0, decltype(input)>::type;
     using word_type = typename std::tuple_element<1, decltype(input)>::type;
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <math.h>
+#include <random>
+
+#include "benchmark_utils.hpp"
+#include "bitlib/bit-algorithms/count.hpp"
+#include "bitlib/bit-containers/bit_rank_select.hpp"
+
+auto BM_BitRankSelectRank = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    bit::rank_select index(first, last);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dist(0, total_bits);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.rank(dist(gen)));
+        benchmark::ClobberMemory();
+    }
+};
+
+// Baseline: rank through repeated bit::count calls
+auto BM_BitCountRank = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dist(0, total_bits);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::count(first, first + dist(gen), bit::bit1));
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitRankSelectSelect = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    bit::rank_select index(first, last);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dist(0, index.count(bit::bit1) - 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.select(dist(gen)));
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitRankSelectBuild = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    for (auto _ : state) {
+        bit::rank_select index(first, last);
+        benchmark::DoNotOptimize(index);
+        benchmark::ClobberMemory();
+    }
+};
@@ -43,3 +43,22 @@ auto BM_BoolRotate = [](benchmark::State& state, auto input) {
         benchmark::ClobberMemory();
     }
 };
+
+// Rotation amount sweep: state.range(0) is the split point in 64ths of the
+// range, nudged off word boundaries so the unaligned paths are measured.
+auto BM_BitRotateSweep = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    auto n_first = first + (total_bits / 64) * state.range(0) + 3;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::rotate(first + 1, n_first, last));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (total_bits / CHAR_BIT));
+};
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+#include <math.h>
+
+#include "benchmark_utils.hpp"
+#include "bitlib/bit-algorithms/find.hpp"
+#include "bitlib/bit-algorithms/for_each_set_bit.hpp"
+#include "bitlib/bit-iterator/bit_set_bits_view.hpp"
+
+auto BM_BitForEachSetBit = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont)) + 1;
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont)) - 1;
+    for (auto _ : state) {
+        size_t sum = 0;
+        bit::for_each_set_bit(first, last, [&sum](size_t i) { sum += i; });
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitSetBitsView = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont)) + 1;
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont)) - 1;
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (size_t i : bit::set_bits(first, last)) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+};
+
+// Baseline: enumerate through repeated bit::find calls
+auto BM_BitFindSetBits = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont)) + 1;
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont)) - 1;
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (auto it = bit::find(first, last, bit::bit1); it != last; it = bit::find(it + 1, last, bit::bit1)) {
+            sum += it - first;
+        }
+        benchmark::DoNotOptimize(sum);
+        benchmark::ClobberMemory();
+    }
+};
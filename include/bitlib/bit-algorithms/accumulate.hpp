@@ -12,6 +12,7 @@
 
 #include "bitlib/bit-iterator/bit_iterator.hpp"
 #include "bitlib/bit-iterator/bit_details.hpp"
+#include "bitlib/bit-iterator/bit_word_view.hpp"
 
 namespace bit {
 
@@ -36,29 +37,34 @@ constexpr auto accumulate(
   using size_type = typename bit_iterator<RandomAccessIt>::size_type;
   constexpr size_type digits = bitsof<word_type>();
 
-  size_type total_bits_to_op = distance(first, last);
   if constexpr (initial_sub_word) {
-    size_type sub_digits;
+    // Whole storage words go to binary_op, the partial head and tail words
+    // to binary_op_subword
+    const auto segments = words(first, last);
+    auto step = [&](const auto& segment) {
+      if (segment.full()) {
+        acc = binary_op(std::move(acc), segment.word);
+      } else {
+        acc = binary_op_subword(std::move(acc), segment.value(), segment.size());
+      }
+    };
     if constexpr (forward) {
-      sub_digits = std::min(digits - first.position(), total_bits_to_op);
-      if (sub_digits != 0) {
-        acc = binary_op_subword(std::move(acc), get_masked_word<word_type>(first, sub_digits), sub_digits);
-        advance(first, digits - first.position());
+      for (auto it = segments.begin(); it != segments.end(); ++it) {
+        step(*it);
       }
     } else {
-      sub_digits = std::min(last.position(), total_bits_to_op);
-      if (sub_digits != 0) {
-        reverse(last, sub_digits);
-        acc = binary_op_subword(std::move(acc), get_masked_word<word_type>(last, sub_digits), sub_digits);
+      for (auto it = segments.end(); it != segments.begin();) {
+        step(*--it);
       }
     }
-    total_bits_to_op -= sub_digits;
+    return acc;
   }
 
+  const size_type total_bits_to_op = distance(first, last);
   const size_type whole_words_to_op = total_bits_to_op / digits;
   const size_type remaining_bits_to_op = total_bits_to_op % digits;
 
-  for (size_t i = 0; i < whole_words_to_op; i ++) {
+  for (size_type i = 0; i < whole_words_to_op; i ++) {
     if constexpr (forward) {
       acc = binary_op(std::move(acc), get_word<word_type>(first));
       advance(first, digits);
@@ -90,35 +96,34 @@ constexpr auto accumulate_while(
   using size_type = typename bit_iterator<RandomAccessIt>::size_type;
   constexpr size_type digits = bitsof<word_type>();
 
-  size_type total_bits_to_op = distance(first, last);
-  size_type whole_words_to_op = total_bits_to_op / digits;
-
-  bool keep_going = true;;
   if constexpr (initial_sub_word) {
-    if (whole_words_to_op > 1) {
-      size_type sub_digits;
-      if constexpr (forward) {
-        sub_digits = std::min(digits - first.position(), total_bits_to_op);
-        if (sub_digits != 0) {
-          std::tie(keep_going, acc) = binary_op_subword(std::move(acc), get_masked_word<word_type>(first, sub_digits), sub_digits);
-          advance(first, digits - first.position());
-        }
+    const auto segments = words(first, last);
+    bool keep_going = true;
+    auto step = [&](const auto& segment) {
+      if (segment.full()) {
+        std::tie(keep_going, acc) = binary_op(std::move(acc), segment.word);
       } else {
-        sub_digits = std::min(last.position(), total_bits_to_op);
-        if (sub_digits != 0) {
-          reverse(last, sub_digits);
-          std::tie(keep_going, acc) = binary_op_subword(std::move(acc), get_masked_word<word_type>(first, sub_digits), sub_digits);
-        }
+        std::tie(keep_going, acc) = binary_op_subword(std::move(acc), segment.value(), segment.size());
       }
-      total_bits_to_op -= sub_digits;
-      if (!keep_going) {
-        return acc; // Stop early if the operation indicates to stop
+      return keep_going;
+    };
+    if constexpr (forward) {
+      auto it = segments.begin();
+      while (it != segments.end() && step(*it)) {
+        ++it;
+      }
+    } else {
+      auto it = segments.end();
+      while (it != segments.begin() && step(*--it)) {
       }
     }
+    return acc;
   }
 
-  whole_words_to_op = total_bits_to_op / digits;
+  const size_type total_bits_to_op = distance(first, last);
+  const size_type whole_words_to_op = total_bits_to_op / digits;
   const size_type remaining_bits_to_op = total_bits_to_op % digits;
+  bool keep_going = true;
 
   for (size_type i = 0; i < whole_words_to_op; i ++) {
     if constexpr (forward) {
@@ -1,7 +1,7 @@
-// ================================== MOVE ================================== //
+// ================================ ADDITION ================================ //
 // Project: The Experimental Bit Algorithms Library
 // Name: addition.hpp
-// Description: bit range multiplication
+// Description: bit range addition
 // Contributor(s):
 // License: BSD 3-Clause License
 // ========================================================================== //
@@ -12,15 +12,62 @@
 // ============================== PREAMBLE ================================== //
 // C++ standard library
 #include <type_traits>
+#include <utility>
 #include <math.h>
 // Project sources
-#include "bitlib/bit-algorithms/transform.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
 #include "bitlib/bit-containers/bit_bitsof.hpp"
 #include "bitlib/bit-iterator/bit_details.hpp"
 #include "bitlib/bit-iterator/bit_iterator.hpp"
 
 namespace bit {
 
+namespace detail {
+
+// Adds (Add) or subtracts (!Add) the words returned by operand(bits) to/from
+// [first, last), from the least significant word upward, storing into d_first.
+// Returns the carry/borrow out of the most significant bit of the range.
+template <bool Add, typename It, typename OutIt, typename OperandFunc>
+constexpr unsigned char add_sub_chain(
+    bit_iterator<It> first,
+    const bit_iterator<It>& last,
+    bit_iterator<OutIt> d_first,
+    OperandFunc operand) {
+  using word_type = std::remove_cvref_t<typename bit_iterator<It>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<It>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  size_type remaining = distance(first, last);
+  unsigned char carry = 0;
+  while (remaining >= digits) {
+    uword_type result;
+    carry = add_carry_sub_borrow<Add, uword_type>(
+        carry,
+        static_cast<uword_type>(get_word<word_type>(first, digits)),
+        static_cast<uword_type>(operand(digits)),
+        &result);
+    write_word<word_type>(static_cast<word_type>(result), d_first, digits);
+    advance(first, digits);
+    advance(d_first, digits);
+    remaining -= digits;
+  }
+  if (remaining > 0) {
+    uword_type result;
+    carry = add_carry_sub_borrow<Add, uword_type>(
+        carry,
+        static_cast<uword_type>(get_masked_word<word_type>(first, remaining)),
+        static_cast<uword_type>(operand(remaining)),
+        &result);
+    // Anything above the partial word is a carry/borrow out of the range
+    carry = carry | (0 != lsr(result, remaining));
+    write_word<word_type>(static_cast<word_type>(result), d_first, remaining);
+  }
+  return carry;
+}
+
+}  // namespace detail
+
 template <typename It, typename U>
   requires(
       (is_static_castable_v<U, typename bit_iterator<It>::word_type>) &&
@@ -30,18 +77,13 @@ constexpr unsigned char addition(
     const bit_iterator<It>& last,
     const bit_iterator<It>& d_first,
     const U& integral_operand) {
-  using word_type = typename bit_iterator<It>::word_type;
-  unsigned char carry = 0;
-  transform(first, last, d_first,
-            [&carry, integral_operand](auto word, auto bits = bitsof<word_type>()) -> word_type {
-              word_type result_word;
-              carry = add_carry(carry, static_cast<word_type>(integral_operand), word, &result_word);
-              if (bits < bitsof<word_type>()) {
-                carry = carry | (0 != lsr(result_word, bits));
-              }
-              return result_word;
-            });
-  return carry;
+  using word_type = std::remove_cvref_t<typename bit_iterator<It>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  // The operand only applies to the least significant word
+  uword_type operand = static_cast<uword_type>(static_cast<word_type>(integral_operand));
+  return detail::add_sub_chain<true>(first, last, d_first, [&operand](auto) {
+    return std::exchange(operand, uword_type{0});
+  });
 }
 
 template <typename It, typename U>
@@ -55,6 +97,29 @@ constexpr unsigned char addition(
   return addition(first, last, first, integral_operand);
 }
 
+// Adds the equally sized ranges [first1, last1) and [first2, ...) into d_first.
+// Returns the carry out of the most significant bit.
+template <typename It1, typename It2, typename OutIt>
+  requires(
+      std::is_same_v<std::remove_cvref_t<typename bit_iterator<It1>::word_type>,
+                     std::remove_cvref_t<typename bit_iterator<It2>::word_type>> &&
+      std::is_same_v<std::remove_cvref_t<typename bit_iterator<It1>::word_type>,
+                     std::remove_cvref_t<typename bit_iterator<OutIt>::word_type>>)
+constexpr unsigned char addition(
+    const bit_iterator<It1>& first1,
+    const bit_iterator<It1>& last1,
+    bit_iterator<It2> first2,
+    const bit_iterator<OutIt>& d_first) {
+  using word_type = std::remove_cvref_t<typename bit_iterator<It1>::word_type>;
+  return detail::add_sub_chain<true>(first1, last1, d_first, [&first2](auto bits) {
+    const word_type word = (bits < bitsof<word_type>())
+                               ? get_masked_word<word_type>(first2, bits)
+                               : get_word<word_type>(first2, bits);
+    advance(first2, bits);
+    return word;
+  });
+}
+
 } // namespace bit
 
 #endif  // _ADDITION_HPP_INCLUDED
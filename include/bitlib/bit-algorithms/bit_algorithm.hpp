@@ -19,6 +19,7 @@
 // <algorithm> overloads
 #include "addition.hpp"
 #include "bit_algorithm_details.hpp"
+#include "compress.hpp"
 #include "copy.hpp"
 #include "copy_backward.hpp"
 #include "count.hpp"
@@ -26,15 +27,19 @@
 #include "equal.hpp"
 #include "fill.hpp"
 #include "find.hpp"
+#include "for_each_set_bit.hpp"
 #include "move.hpp"
 #include "multiplication.hpp"
 #include "reverse.hpp"
 #include "rotate.hpp"
 #include "shift.hpp"
+#include "streaming.hpp"
+#include "subtraction.hpp"
 #include "swap_ranges.hpp"
 #include "to_from_string.hpp"
 #include "transform.hpp"
 #include "transform_accumulate.hpp"
+#include "transform_count.hpp"
 #include "type_traits.hpp"
 // ========================================================================== //
 
@@ -15,6 +15,11 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <algorithm>
+#include <execution>
+#include <thread>
+#include <utility>
+#include <vector>
 // Project sources
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
@@ -204,6 +209,89 @@ void write_word(src_type src, bit_iterator<OutputIt> dst_bit_it,
   return;
 }
 
+// Writes n words starting at d_first, word i being the bits of first[i]
+// from position shift upwards followed by the low bits of first[i + 1].
+// Reads first[0 .. n]. 0 < shift < digits. Every output word is computed
+// independently of the others so the loop vectorizes.
+template <class WordType, class SrcIt, class DstIt>
+constexpr DstIt _shift_copy_words(SrcIt first, std::size_t n, std::size_t shift, DstIt d_first) {
+  using uword_type = std::make_unsigned_t<std::remove_cv_t<WordType>>;
+  constexpr std::size_t digits = binary_digits<uword_type>::value;
+  for (std::size_t i = 0; i < n; ++i) {
+    const uword_type lo = static_cast<uword_type>(first[i]);
+    const uword_type hi = static_cast<uword_type>(first[i + 1]);
+    d_first[i] = static_cast<WordType>((lo >> shift) | static_cast<uword_type>(hi << (digits - shift)));
+  }
+  return d_first + n;
+}
+
+// As _shift_copy_words, writing the n words before d_last from the last
+// word down, for copies into an overlapping destination to the right
+template <class WordType, class SrcIt, class DstIt>
+constexpr DstIt _shift_copy_words_backward(SrcIt first, std::size_t n, std::size_t shift, DstIt d_last) {
+  using uword_type = std::make_unsigned_t<std::remove_cv_t<WordType>>;
+  constexpr std::size_t digits = binary_digits<uword_type>::value;
+  DstIt d_first = d_last - n;
+  for (std::size_t i = n; i-- > 0;) {
+    const uword_type lo = static_cast<uword_type>(first[i]);
+    const uword_type hi = static_cast<uword_type>(first[i + 1]);
+    d_first[i] = static_cast<WordType>((lo >> shift) | static_cast<uword_type>(hi << (digits - shift)));
+  }
+  return d_first;
+}
+
+// In-place forms of _shift_copy_words, for a destination that overlaps the
+// source: dst[i] = funnel of src[i] and src[i + 1] for i in [0, n). The
+// plain loop is only vectorized behind a runtime no-overlap check, so a
+// shift in place would run it scalar. Here each block of words is loaded
+// before it is stored, which is safe when dst <= src walking forwards and
+// when dst > src walking backwards.
+template <class WordType>
+void _shift_words_forward(WordType* dst, const WordType* src, std::size_t n, std::size_t shift) {
+  using uword_type = std::make_unsigned_t<std::remove_cv_t<WordType>>;
+  constexpr std::size_t digits = binary_digits<uword_type>::value;
+  std::size_t i = 0;
+#if defined(__GNUC__)
+  typedef uword_type block_type __attribute__((vector_size(32)));
+  constexpr std::size_t lanes = sizeof(block_type) / sizeof(uword_type);
+  for (; i + lanes <= n; i += lanes) {
+    block_type lo, hi;
+    __builtin_memcpy(&lo, src + i, sizeof(lo));
+    __builtin_memcpy(&hi, src + i + 1, sizeof(hi));
+    const block_type out = (lo >> shift) | (hi << (digits - shift));
+    __builtin_memcpy(dst + i, &out, sizeof(out));
+  }
+#endif
+  for (; i < n; ++i) {
+    const uword_type lo = static_cast<uword_type>(src[i]);
+    const uword_type hi = static_cast<uword_type>(src[i + 1]);
+    dst[i] = static_cast<WordType>((lo >> shift) | static_cast<uword_type>(hi << (digits - shift)));
+  }
+}
+
+template <class WordType>
+void _shift_words_backward(WordType* dst, const WordType* src, std::size_t n, std::size_t shift) {
+  using uword_type = std::make_unsigned_t<std::remove_cv_t<WordType>>;
+  constexpr std::size_t digits = binary_digits<uword_type>::value;
+  std::size_t i = n;
+#if defined(__GNUC__)
+  typedef uword_type block_type __attribute__((vector_size(32)));
+  constexpr std::size_t lanes = sizeof(block_type) / sizeof(uword_type);
+  for (; i >= lanes; i -= lanes) {
+    block_type lo, hi;
+    __builtin_memcpy(&lo, src + i - lanes, sizeof(lo));
+    __builtin_memcpy(&hi, src + i - lanes + 1, sizeof(hi));
+    const block_type out = (lo >> shift) | (hi << (digits - shift));
+    __builtin_memcpy(dst + i - lanes, &out, sizeof(out));
+  }
+#endif
+  while (i-- > 0) {
+    const uword_type lo = static_cast<uword_type>(src[i]);
+    const uword_type hi = static_cast<uword_type>(src[i + 1]);
+    dst[i] = static_cast<WordType>((lo >> shift) | static_cast<uword_type>(hi << (digits - shift)));
+  }
+}
+
 // Shifts the range [first, last) to the left by n, filling the empty
 // bits with 0
 template <class RandomAccessIt>
@@ -237,6 +325,38 @@ RandomAccessIt word_shift_right(RandomAccessIt first,
     return std::next(first, n);
 }
 
+// Smallest chunk (in words) handed to a worker by the execution policy overloads
+constexpr std::size_t _parallel_min_chunk_words = 4096;
+
+// Splits a range of n bits into [begin, end) bit offsets for the execution
+// policy overloads. Interior boundaries fall on word boundaries of the
+// iterator whose position is `position`, so no two chunks touch the same
+// word of that range and the partial head/tail words are handled once.
+template <class WordType, class Difference>
+std::vector<std::pair<Difference, Difference>> _parallel_chunks(
+    Difference n,
+    std::size_t position) {
+  constexpr Difference digits = binary_digits<WordType>::value;
+  const Difference workers = std::max(1u, std::thread::hardware_concurrency());
+  const Difference target = (n + workers * 4 - 1) / (workers * 4);
+  const Difference min_chunk = static_cast<Difference>(_parallel_min_chunk_words) * digits;
+  const Difference chunk = ((std::max(target, min_chunk) + digits - 1) / digits) * digits;
+
+  std::vector<std::pair<Difference, Difference>> chunks;
+  Difference begin = 0;
+  Difference end = chunk - static_cast<Difference>(position);
+  while (end < n) {
+    chunks.emplace_back(begin, end);
+    begin = end;
+    end += chunk;
+  }
+  chunks.emplace_back(begin, n);
+  return chunks;
+}
+
+template <class ExecutionPolicy>
+concept _execution_policy = std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>;
+
 // returns a word consisting of all one bits
 constexpr auto _all_ones() {
     return -1;
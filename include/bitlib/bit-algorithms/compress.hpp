@@ -0,0 +1,119 @@
+// ================================ COMPRESS ================================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        compress.hpp
+// Description: Mask-driven bit gather (compress) and scatter (expand)
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_COMPRESS_HPP_INCLUDED
+#define _BIT_COMPRESS_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+
+namespace bit {
+
+/**
+ * @brief Copies the bits of [first, last) whose mask bit is set to
+ *        consecutive positions starting at d_first
+ *
+ * The range version of pext. Each word of the source is gathered with one
+ * _pext against the matching mask bits, and the results are packed into
+ * whole destination words before they are stored.
+ *
+ * @return The end of the written range, d_first + count of ones in the mask
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2, typename RandomAccessIt3>
+  requires(std::is_same_v<std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>,
+                          std::remove_cv_t<typename bit_iterator<RandomAccessIt2>::word_type>> &&
+           std::is_same_v<std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>,
+                          typename bit_iterator<RandomAccessIt3>::word_type>)
+bit_iterator<RandomAccessIt3> compress(
+    bit_iterator<RandomAccessIt1> first,
+    bit_iterator<RandomAccessIt1> last,
+    bit_iterator<RandomAccessIt2> mask_first,
+    bit_iterator<RandomAccessIt3> d_first) {
+  using word_type = typename bit_iterator<RandomAccessIt3>::word_type;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<RandomAccessIt3>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  _assert_range_viability(first, last);
+  size_type remaining = distance(first, last);
+  // Gathered bits not yet stored, in the low `filled` bits of pending
+  uword_type pending = 0;
+  size_type filled = 0;
+  while (remaining) {
+    // After the first step the source is read a whole word at a time
+    const size_type len = std::min(remaining, digits - first.position());
+    const uword_type m = static_cast<uword_type>(get_word<word_type>(mask_first, len)) & _mask<uword_type, _mask_len::unknown>(len);
+    const uword_type gathered = static_cast<uword_type>(_pext(static_cast<uword_type>(get_word<word_type>(first, len)), m));
+    const size_type n = static_cast<size_type>(std::popcount(m));
+    pending |= static_cast<uword_type>(gathered << filled);
+    if (filled + n >= digits) {
+      write_word(static_cast<word_type>(pending), d_first, digits);
+      d_first += digits;
+      pending = filled ? static_cast<uword_type>(gathered >> (digits - filled)) : uword_type(0);
+      filled = filled + n - digits;
+    } else {
+      filled += n;
+    }
+    first += len;
+    mask_first += len;
+    remaining -= len;
+  }
+  if (filled) {
+    write_word(static_cast<word_type>(pending), d_first, filled);
+    d_first += filled;
+  }
+  return d_first;
+}
+
+/**
+ * @brief Writes [mask_first, mask_last) to d_first with every set mask bit
+ *        replaced by the next bit of src_first and every clear bit by bit0
+ *
+ * The range version of pdep, a word of mask at a time; src_first advances
+ * by the number of ones in the mask.
+ *
+ * @return d_first + distance(mask_first, mask_last)
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2, typename RandomAccessIt3>
+  requires(std::is_same_v<std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>,
+                          std::remove_cv_t<typename bit_iterator<RandomAccessIt2>::word_type>> &&
+           std::is_same_v<std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>,
+                          typename bit_iterator<RandomAccessIt3>::word_type>)
+bit_iterator<RandomAccessIt3> expand(
+    bit_iterator<RandomAccessIt1> mask_first,
+    bit_iterator<RandomAccessIt1> mask_last,
+    bit_iterator<RandomAccessIt2> src_first,
+    bit_iterator<RandomAccessIt3> d_first) {
+  using word_type = typename bit_iterator<RandomAccessIt3>::word_type;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<RandomAccessIt3>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  _assert_range_viability(mask_first, mask_last);
+  size_type remaining = distance(mask_first, mask_last);
+  while (remaining) {
+    // After the first step the destination is written a whole word at a time
+    const size_type len = std::min(remaining, digits - d_first.position());
+    const uword_type m = static_cast<uword_type>(get_word<word_type>(mask_first, len)) & _mask<uword_type, _mask_len::unknown>(len);
+    const size_type n = static_cast<size_type>(std::popcount(m));
+    const uword_type src = n ? static_cast<uword_type>(get_word<word_type>(src_first, n)) : uword_type(0);
+    write_word(static_cast<word_type>(_pdep(src, m)), d_first, len);
+    src_first += n;
+    mask_first += len;
+    d_first += len;
+    remaining -= len;
+  }
+  return d_first;
+}
+
+}  // namespace bit
+
+#endif  // _BIT_COMPRESS_HPP_INCLUDED
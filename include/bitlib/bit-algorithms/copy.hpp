@@ -16,13 +16,17 @@
 #include <type_traits>
 #include <math.h>
 // Project sources
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-algorithms/streaming.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace bit {
 // ========================================================================== //
 
-struct copy_impl;
+template <detail::store_mode Mode = detail::store_mode::automatic>
+struct copy_impl_t;
+using copy_impl = copy_impl_t<>;
 
 template <typename It1, typename It2>
 constexpr bit_iterator<It2> copy(
@@ -48,8 +52,59 @@ constexpr bit_iterator<It2> copy(
   return with_bit_iterator_adapter<copy_impl>(first, last, d_first);
 }
 
+// Copies with non-temporal stores so the destination does not displace
+// the cache
+template <typename It1, typename It2>
+bit_iterator<It2> copy(
+    policy::streaming_t,
+    const bit_iterator<It1>& first,
+    const bit_iterator<It1>& last,
+    const bit_iterator<It2>& d_first) {
+  return with_bit_iterator_adapter<copy_impl_t<detail::store_mode::streaming>>(first, last, d_first);
+}
+
+// Copies through the cache whatever the size of the range
+template <typename It1, typename It2>
+bit_iterator<It2> copy(
+    policy::cached_t,
+    const bit_iterator<It1>& first,
+    const bit_iterator<It1>& last,
+    const bit_iterator<It2>& d_first) {
+  return with_bit_iterator_adapter<copy_impl_t<detail::store_mode::cached>>(first, last, d_first);
+}
+
+// Copies chunks concurrently. Chunks are aligned to the destination words
+// so that no two workers write to the same word. Whether to stream is
+// decided once for the whole range rather than per chunk.
+template <_execution_policy ExecutionPolicy, typename It1, typename It2>
+bit_iterator<It2> copy(
+    ExecutionPolicy&& policy,
+    const bit_iterator<It1>& first,
+    const bit_iterator<It1>& last,
+    const bit_iterator<It2>& d_first) {
+  _assert_range_viability(first, last);
+  using dst_word_type = typename bit_iterator<It2>::word_type;
+  const auto n = distance(first, last);
+
+  const bool streaming = detail::use_streaming<dst_word_type>(
+      detail::store_mode::automatic, n / binary_digits<dst_word_type>::value);
+  const auto chunks = _parallel_chunks<dst_word_type>(n, d_first.position());
+  std::for_each(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      [&first, &d_first, streaming](const auto& chunk) {
+        if (streaming) {
+          bit::copy(bit::policy::streaming, first + chunk.first, first + chunk.second, d_first + chunk.first);
+        } else {
+          bit::copy(bit::policy::cached, first + chunk.first, first + chunk.second, d_first + chunk.first);
+        }
+      });
+  return d_first + n;
+}
+
 // ---------------------------- Copy Algorithms ----------------------------- //
-struct copy_impl {
+template <detail::store_mode Mode>
+struct copy_impl_t {
   // Status: Does not work for Input/Output iterators due to distance call
   template <typename RandomAccessIt1, typename RandomAccessIt2>
   constexpr bit_iterator<RandomAccessIt2> operator()(
@@ -102,17 +157,18 @@ struct copy_impl {
         // d_first will be aligned at this point
         if (is_first_aligned && remaining_bits_to_copy > digits) {
             auto N = ::std::distance(first.base(), last.base());
-            it = ::std::copy(first.base(), last.base(), it);
+            it = _copy_words<Mode>(first.base(), last.base(), it);
             first += digits * N;
             remaining_bits_to_copy -= digits * N;
         } else {
-            // TODO benchmark if its faster to ::std::copy the entire range then shift
-            while (remaining_bits_to_copy >= digits) {
-                *it = get_word<word_type>(first, digits);
-                remaining_bits_to_copy -= digits;
-                it++;
-                advance(first, digits);
+            const size_type words = remaining_bits_to_copy / digits;
+            if (is_first_aligned) {
+                it = _copy_words<Mode>(first.base(), ::std::next(first.base(), words), it);
+            } else {
+                it = _shift_copy_words<word_type>(first.base(), words, first.position(), it);
             }
+            remaining_bits_to_copy -= digits * words;
+            advance(first, digits * words);
         }
         if (remaining_bits_to_copy > 0) {
           *it = _bitblend<word_type>(
@@ -76,12 +76,14 @@ constexpr bit_iterator<RandomAccessIt2> copy_backward(bit_iterator<RandomAccessI
         last -= digits * N;
         remaining_bits_to_copy -= digits * N;
       } else {
-        // TODO benchmark if its faster to ::std::copy the entire range then shift
-        while (remaining_bits_to_copy >= digits) {
-          *(--it) = get_word<word_type>(last - digits, digits);
-          remaining_bits_to_copy -= digits;
-          reverse(last, digits);
+        const size_type words = remaining_bits_to_copy / digits;
+        if (is_last_aligned) {
+          it = ::std::copy_backward(::std::prev(last.base(), words), last.base(), it);
+        } else {
+          it = _shift_copy_words_backward<word_type>(::std::prev(last.base(), words), words, last.position(), it);
         }
+        remaining_bits_to_copy -= digits * words;
+        reverse(last, digits * words);
       }
       if (remaining_bits_to_copy > 0) {
         it--;
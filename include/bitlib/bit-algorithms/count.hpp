@@ -13,6 +13,7 @@
 #include <numeric>
 // Project sources
 #include "bitlib/bit-algorithms/accumulate.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
 #include "bitlib/bit-algorithms/libpopcnt.h"
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
@@ -32,6 +33,37 @@ namespace hn = hwy::HWY_NAMESPACE;
 #endif
 // ========================================================================== //
 
+#ifdef BITLIB_HWY
+namespace detail {
+
+// Counts the set bits of `size` bytes. Per-byte counts are accumulated in
+// vector lanes and only widened every 31 vectors (31 * 8 < 256), so there
+// is no horizontal reduction inside the loop.
+inline uint64_t popcount_bytes(const void* data, uint64_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  const hn::ScalableTag<uint8_t> d8;
+  const hn::Repartition<uint64_t, decltype(d8)> d64;
+  const uint64_t N = hn::Lanes(d8);
+
+  auto total = hn::Zero(d64);
+  uint64_t i = 0;
+  while (i + N <= size) {
+    auto partial = hn::Zero(d8);
+    for (int k = 0; k < 31 && i + N <= size; ++k, i += N) {
+      partial = hn::Add(partial, hn::PopulationCount(hn::LoadU(d8, bytes + i)));
+    }
+    total = hn::Add(total, hn::SumsOf8(partial));
+  }
+  uint64_t result = hn::ReduceSum(d64, total);
+  if (i != size) {
+    result += popcnt(bytes + i, size - i);
+  }
+  return result;
+}
+
+}  // namespace detail
+#endif
+
 template<class RandomAccessIt>
 constexpr typename bit_iterator<RandomAccessIt>::difference_type
 count(
@@ -60,45 +92,17 @@ count(
         result = std::popcount(static_cast<std::make_unsigned_t<word_type>>(first_value));
         ++it;
       }
-// The SIMD implementation here is actually slower than the standard
-//#ifdef BITLIB_HWY
-        //// ReduceSum not implemented for unsigned char
-        //if constexpr (digits > 8)
-        //{
-            //// Align to boundary
-            //for (; it != last.base() && !is_aligned(&(*it), 64); ++it) {
-      //result += std::popcount(*it);
-      //}
-
-      //// SIMD
-      //hn::ScalableTag<word_type> d;
-      //for (; std::distance(it, last.base()) >= hn::Lanes(d); it += hn::Lanes(d))
-      //{
-      //const auto popcntV = hn::PopulationCount(hn::Load(d, &*it));
-      //result += hn::ReduceSum(d, popcntV);
-      //}
-
-      //// Remaining
-      //for (; it != last.base(); ++it) {
-      //result += std::popcount(*it);
-      //}
-      //} else
-      //#endif
-      {
-        // std:: version
-        //result += std::transform_reduce(
-        //it,
-        //last.base(),
-        //0,
-        //std::plus{},
-        //[](word_type word) {return std::popcount(word); }
-        //);
-
-        // libpopcnt
-        auto words = (digits / 8) * std::distance(it, last.base());
-        if (0 != words) {
-          result += popcnt(&*it, words);
-        }
+      // Whole words: bulk popcount over the contiguous storage.
+      // libpopcnt selects its AVX512 VPOPCNT / AVX2 Harley-Seal / scalar
+      // kernel at runtime from cpuid; the Highway kernel is used instead
+      // when the library is built for a fixed SIMD target.
+      auto bytes = (digits / 8) * std::distance(it, last.base());
+      if (0 != bytes) {
+#ifdef BITLIB_HWY
+        result += detail::popcount_bytes(&*it, bytes);
+#else
+        result += popcnt(&*it, bytes);
+#endif
       }
       if (last.position() != 0) {
         word_type last_value = static_cast<word_type>(*last.base() << (digits - last.position()));
@@ -122,6 +126,29 @@ count(
     return result;
 }
 
+// Counts each word-aligned chunk under the execution policy and sums the results
+template <_execution_policy ExecutionPolicy, class RandomAccessIt>
+typename bit_iterator<RandomAccessIt>::difference_type
+count(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    bit_value value) {
+  _assert_range_viability(first, last);
+  using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+  using difference_type = typename bit_iterator<RandomAccessIt>::difference_type;
+
+  const auto chunks = _parallel_chunks<word_type>(distance(first, last), first.position());
+  return std::transform_reduce(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      difference_type(0),
+      std::plus<difference_type>{},
+      [first, value](const auto& chunk) {
+        return bit::count(first + chunk.first, first + chunk.second, value);
+      });
+}
+
 template <class RandomAccessIt>
 constexpr int count_msb(
     bit_iterator<RandomAccessIt> first,
@@ -14,6 +14,7 @@
 #include <type_traits>
 #include <math.h>
 // Project sources
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
 // Miscellaneous
@@ -30,6 +31,25 @@ constexpr bool equal(
   return with_bit_iterator_adapter<equal_impl>(first, last, d_first);
 }
 
+// Compares word-aligned chunks of the first range concurrently
+template <_execution_policy ExecutionPolicy, typename RandomAccessIt1, typename RandomAccessIt2>
+bool equal(
+    ExecutionPolicy&& policy,
+    const bit_iterator<RandomAccessIt1>& first,
+    const bit_iterator<RandomAccessIt1>& last,
+    const bit_iterator<RandomAccessIt2>& d_first) {
+  _assert_range_viability(first, last);
+  using word_type = typename bit_iterator<RandomAccessIt1>::word_type;
+
+  const auto chunks = _parallel_chunks<word_type>(distance(first, last), first.position());
+  return std::all_of(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      [&first, &d_first](const auto& chunk) {
+        return bit::equal(first + chunk.first, first + chunk.second, d_first + chunk.first);
+      });
+}
+
 // ---------------------------- Equal Algorithms ----------------------------- //
 
 // Status: Does not work for Input/Output iterators due to distance call
@@ -16,6 +16,7 @@
 // C++ standard library
 // Project sources
 #include "bit_algorithm_details.hpp"
+#include "streaming.hpp"
 // Third-party libraries
 #ifdef BITLIB_HWY
 #include "hwy/highway.h"
@@ -35,8 +36,8 @@ namespace hn = hwy::HWY_NAMESPACE;
 
 
 // Status: needs revisions
-template <class RandomAccessIt>
-void fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
+template <detail::store_mode Mode, class RandomAccessIt>
+void _fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
     bit::bit_value bv) {
     // Assertions
     _assert_range_viability(first, last);
@@ -62,18 +63,20 @@ void fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
         }
 
 #ifdef BITLIB_HWY
-        // Align to 64 bit boundary
-        for (; it != last.base() && !is_aligned(&*it, 64); it++) {
-            *it = fill_word;
-        }
-        const hn::ScalableTag<word_type> d;
-        const auto fill_vec = bv == bit0 ? hn::Set(d, 0) : hn::Set(d, ones);
-        for (; std::distance(it, last.base()) >= hn::Lanes(d); it += hn::Lanes(d))
-        {
-            hn::Store(fill_vec, d, &*it);
+        if (!detail::use_streaming<word_type>(Mode, std::distance(it, last.base()))) {
+          // Align to 64 bit boundary
+          for (; it != last.base() && !is_aligned(&*it, 64); it++) {
+              *it = fill_word;
+          }
+          const hn::ScalableTag<word_type> d;
+          const auto fill_vec = bv == bit0 ? hn::Set(d, 0) : hn::Set(d, ones);
+          for (; std::distance(it, last.base()) >= hn::Lanes(d); it += hn::Lanes(d))
+          {
+              hn::Store(fill_vec, d, &*it);
+          }
         }
 #endif
-        std::fill(it, last.base(), fill_word);
+        _fill_words<Mode>(it, last.base(), fill_word);
         if (last.position() != 0) {
             it = last.base();
             write_word<word_type>(fill_word, bit_iterator<word_type*>(&(*it)), last.position());
@@ -81,6 +84,52 @@ void fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
     }
 }
 
+template <class RandomAccessIt>
+void fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
+    bit::bit_value bv) {
+    _fill<detail::store_mode::automatic>(first, last, bv);
+}
+
+// Fills with non-temporal stores so the range does not displace the cache
+template <class RandomAccessIt>
+void fill(policy::streaming_t, bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last, bit::bit_value bv) {
+    _fill<detail::store_mode::streaming>(first, last, bv);
+}
+
+// Fills through the cache whatever the size of the range
+template <class RandomAccessIt>
+void fill(policy::cached_t, bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last, bit::bit_value bv) {
+    _fill<detail::store_mode::cached>(first, last, bv);
+}
+
+// Fills word-aligned chunks concurrently; only the first and last chunk
+// touch a partial word. Whether to stream is decided once for the whole
+// range rather than per chunk.
+template <_execution_policy ExecutionPolicy, class RandomAccessIt>
+void fill(ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
+    bit::bit_value bv) {
+    _assert_range_viability(first, last);
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+
+    const auto n = distance(first, last);
+    const bool streaming = detail::use_streaming<word_type>(
+        detail::store_mode::automatic, n / binary_digits<word_type>::value);
+    const auto chunks = _parallel_chunks<word_type>(n, first.position());
+    std::for_each(
+        std::forward<ExecutionPolicy>(policy),
+        chunks.begin(), chunks.end(),
+        [first, bv, streaming](const auto& chunk) {
+            if (streaming) {
+                _fill<detail::store_mode::streaming>(first + chunk.first, first + chunk.second, bv);
+            } else {
+                _fill<detail::store_mode::cached>(first + chunk.first, first + chunk.second, bv);
+            }
+        });
+}
+
 // ========================================================================== //
 } // namespace bit
 #ifdef BITLIB_HWY
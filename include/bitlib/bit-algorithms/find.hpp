@@ -1,6 +1,6 @@
 // ================================== FIND ================================== //
 // Project: The Experimental Bit Algorithms Library
-// Description: bit_iterator overloads for std::find, std::find_if, std::find_if_not
+// Description: bit_iterator overloads for std::find and std::ranges::find_last
 // License: BSD 3-Clause License
 // ========================================================================== //
 #ifndef _FIND_HPP_INCLUDED
@@ -9,9 +9,15 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <algorithm>
+#include <atomic>
 #include <bit>
+#include <cstddef>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 // Project sources
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
 #ifdef BITLIB_HWY
@@ -31,13 +37,98 @@ namespace hn = hwy::HWY_NAMESPACE;
 // ========================================================================== //
 
 
+namespace detail {
+
+// Words OR-reduced per probe when skipping empty regions: one cache line
+template <class WordType>
+constexpr std::size_t find_block_words = (sizeof(WordType) < 64) ? 64 / sizeof(WordType) : 1;
+
+// Returns the first word of [first, last) that differs from empty, or last.
+// Whole cache lines are tested with a single OR-reduction of w ^ empty,
+// which compilers vectorize, so runs of empty words cost one branch per line.
+template <class WordIt, class WordType>
+constexpr WordIt find_word(WordIt first, WordIt last, const WordType empty) {
+  constexpr auto block = static_cast<std::iter_difference_t<WordIt>>(find_block_words<WordType>);
+#ifdef BITLIB_HWY
+  if constexpr (std::contiguous_iterator<WordIt> && std::is_unsigned_v<WordType>) {
+    const hn::ScalableTag<WordType> d;
+    const std::ptrdiff_t N = hn::Lanes(d);
+    const auto e = hn::Set(d, empty);
+    const WordType* p = std::to_address(first);
+    const WordType* const end = p + std::distance(first, last);
+    for (; end - p >= 4 * N; p += 4 * N) {
+      const auto acc = hn::Or(
+          hn::Or(hn::Xor(hn::LoadU(d, p), e), hn::Xor(hn::LoadU(d, p + N), e)),
+          hn::Or(hn::Xor(hn::LoadU(d, p + 2 * N), e), hn::Xor(hn::LoadU(d, p + 3 * N), e)));
+      if (!hn::AllTrue(d, hn::Eq(acc, hn::Zero(d)))) {
+        break;
+      }
+    }
+    first += p - std::to_address(first);
+  }
+#endif
+  for (; std::distance(first, last) >= block; first += block) {
+    WordType acc = 0;
+    for (std::iter_difference_t<WordIt> i = 0; i < block; ++i) {
+      acc |= static_cast<WordType>(first[i] ^ empty);
+    }
+    if (acc != 0) {
+      break;
+    }
+  }
+  return std::find_if(first, last, [empty](WordType w) { return w != empty; });
+}
+
+// Returns the last word of [first, last) that differs from empty, or last
+template <class WordIt, class WordType>
+constexpr WordIt find_last_word(WordIt first, WordIt last, const WordType empty) {
+  constexpr auto block = static_cast<std::iter_difference_t<WordIt>>(find_block_words<WordType>);
+  WordIt it = last;
+#ifdef BITLIB_HWY
+  if constexpr (std::contiguous_iterator<WordIt> && std::is_unsigned_v<WordType>) {
+    const hn::ScalableTag<WordType> d;
+    const std::ptrdiff_t N = hn::Lanes(d);
+    const auto e = hn::Set(d, empty);
+    const WordType* const begin = std::to_address(first);
+    const WordType* p = begin + std::distance(first, last);
+    for (; p - begin >= 4 * N; p -= 4 * N) {
+      const auto acc = hn::Or(
+          hn::Or(hn::Xor(hn::LoadU(d, p - N), e), hn::Xor(hn::LoadU(d, p - 2 * N), e)),
+          hn::Or(hn::Xor(hn::LoadU(d, p - 3 * N), e), hn::Xor(hn::LoadU(d, p - 4 * N), e)));
+      if (!hn::AllTrue(d, hn::Eq(acc, hn::Zero(d)))) {
+        break;
+      }
+    }
+    it = first + (p - begin);
+  }
+#endif
+  for (; std::distance(first, it) >= block; it -= block) {
+    WordType acc = 0;
+    for (std::iter_difference_t<WordIt> i = 1; i <= block; ++i) {
+      acc |= static_cast<WordType>(it[-i] ^ empty);
+    }
+    if (acc != 0) {
+      break;
+    }
+  }
+  while (it != first) {
+    --it;
+    if (*it != empty) {
+      return it;
+    }
+  }
+  return last;
+}
+
+}  // namespace detail
+
 template <class RandomAccessIt>
 constexpr bit_iterator<RandomAccessIt> find(
         bit_iterator<RandomAccessIt> first,
         bit_iterator<RandomAccessIt> last, bit::bit_value bv
 ) {
 
-    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
     using uword_type = std::make_unsigned_t<word_type>;
     using size_type = typename bit_iterator<RandomAccessIt>::size_type;
     const std::size_t digits = binary_digits<word_type>::value;
@@ -61,51 +152,9 @@ constexpr bit_iterator<RandomAccessIt> find(
       }
     }
 
-    // Initialization
-    auto it = first.base();
-
-// Waiting on github issue
-#ifdef BITLIB_HWY
-    // Align the iterator
-    while (it != last.base() && !is_aligned(&(*it), 64)) {
-        if ((bv == bit1 && (*it == 0)) || (bv == bit0 && (*it == static_cast<word_type>(-1)))) {
-            ++it;
-            continue;
-        }
-
-        size_type num_trailing_complementary_bits = (bv == bit0)
-                                                        ? std::countr_zero(static_cast<uword_type>(~*it))
-                                                        : std::countr_zero(static_cast<uword_type>(*it));
-        return bit_iterator(it, (size_type) num_trailing_complementary_bits);
-    }
-
-    // SIMD
-    hn::ScalableTag<word_type> d;
-    const auto z = hn::Zero(d);
-    for (; std::distance(it, last.base()) >= hn::Lanes(d); it += hn::Lanes(d))
-    {
-        auto v = hn::Load(d, &*it);
-        if (bv == bit0)
-        {
-            v = hn::Not(v);
-        }
-        const auto found = hn::Gt(v, z);
-        if (! hn::AllFalse(d, found))
-        {
-            it += hn::FindKnownFirstTrue(d, found);
-            size_type num_trailing_complementary_bits = (bv == bit0)
-                                                            ? std::countr_zero(static_cast<uword_type>(~*it))
-                                                            : std::countr_zero(static_cast<uword_type>(*it));
-            return bit_iterator(it, (size_type) num_trailing_complementary_bits);
-        }
-    }
-#endif
-
-    if (bv == bit1) {
-        it = std::find_if(it, last.base(), [](word_type a) {return a != 0;});
-    } else {
-        it = std::find_if(it, last.base(), [](word_type a) {return a != static_cast<word_type>(-1);});
-    }
+    // Whole words, skipping empty cache lines
+    const word_type empty = (bv == bit1) ? word_type(0) : static_cast<word_type>(-1);
+    auto it = detail::find_word(first.base(), last.base(), empty);
 
     if (it != last.base()) {
       size_type num_trailing_complementary_bits = (bv == bit0)
@@ -124,6 +173,150 @@ constexpr bit_iterator<RandomAccessIt> find(
     return last;
 }
 
+/**
+ * @brief Finds the last bit equal to bv in [first, last)
+ *
+ * The range is scanned from the back with the same cache line skipping as
+ * find.
+ *
+ * @return An iterator to the last matching bit, or last if there is none
+ */
+template <class RandomAccessIt>
+constexpr bit_iterator<RandomAccessIt> find_last(
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    bit::bit_value bv) {
+  using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+  constexpr size_type digits = binary_digits<word_type>::value;
+
+  _assert_range_viability(first, last);
+  if (first == last) {
+    return last;
+  }
+
+  // Bits equal to bv become ones
+  const auto matches = [bv](word_type w) {
+    return static_cast<uword_type>((bv == bit1) ? w : static_cast<word_type>(~w));
+  };
+  const auto highest = [](RandomAccessIt it, uword_type m) {
+    return bit_iterator<RandomAccessIt>(it, digits - 1 - static_cast<size_type>(std::countl_zero(m)));
+  };
+  const auto low_mask = [](size_type n) {
+    return static_cast<uword_type>((uword_type{1} << n) - 1);
+  };
+
+  RandomAccessIt it = last.base();
+  if (last.position() != 0) {
+    uword_type m = matches(*it) & low_mask(last.position());
+    if (first.base() == last.base()) {
+      m &= static_cast<uword_type>(~low_mask(first.position()));
+      return m ? highest(it, m) : last;
+    }
+    if (m) {
+      return highest(it, m);
+    }
+  }
+
+  // Whole words, skipping empty cache lines
+  const RandomAccessIt full_first = (first.position() == 0) ? first.base() : std::next(first.base());
+  const word_type empty = (bv == bit1) ? word_type(0) : static_cast<word_type>(-1);
+  const RandomAccessIt found = detail::find_last_word(full_first, it, empty);
+  if (found != it) {
+    return highest(found, matches(*found));
+  }
+
+  if (first.position() != 0) {
+    const uword_type m = matches(*first.base()) & static_cast<uword_type>(~low_mask(first.position()));
+    if (m) {
+      return highest(first.base(), m);
+    }
+  }
+  return last;
+}
+
+// Searches word-aligned chunks under the execution policy. The index of the
+// earliest chunk with a hit is shared, and workers give up on later chunks
+// between slices of _parallel_min_chunk_words words, so the first hit
+// stops the remaining scan.
+template <_execution_policy ExecutionPolicy, class RandomAccessIt>
+bit_iterator<RandomAccessIt> find(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    bit::bit_value bv) {
+  _assert_range_viability(first, last);
+  using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+  using difference_type = typename bit_iterator<RandomAccessIt>::difference_type;
+
+  const auto chunks = _parallel_chunks<word_type>(distance(first, last), first.position());
+  std::atomic<std::size_t> hit = chunks.size();
+  std::for_each(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      [first, bv, &chunks, &hit](const auto& chunk) {
+        const std::size_t index = static_cast<std::size_t>(&chunk - chunks.data());
+        constexpr difference_type slice = static_cast<difference_type>(_parallel_min_chunk_words) * binary_digits<word_type>::value;
+        for (auto begin = chunk.first; begin < chunk.second; begin += slice) {
+          if (hit.load(std::memory_order_relaxed) < index) {
+            return;
+          }
+          const auto end = first + std::min(begin + slice, chunk.second);
+          if (bit::find(first + begin, end, bv) != end) {
+            std::size_t current = hit.load(std::memory_order_relaxed);
+            while (index < current && !hit.compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+            }
+            return;
+          }
+        }
+      });
+  if (hit == chunks.size()) {
+    return last;
+  }
+  return bit::find(first + chunks[hit].first, first + chunks[hit].second, bv);
+}
+
+// Mirror of the parallel find: workers abandon chunks before the latest hit
+template <_execution_policy ExecutionPolicy, class RandomAccessIt>
+bit_iterator<RandomAccessIt> find_last(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    bit::bit_value bv) {
+  _assert_range_viability(first, last);
+  using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+  using difference_type = typename bit_iterator<RandomAccessIt>::difference_type;
+
+  const auto chunks = _parallel_chunks<word_type>(distance(first, last), first.position());
+  // One past the index of the latest chunk with a hit, 0 for none
+  std::atomic<std::size_t> hit = 0;
+  std::for_each(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      [first, bv, &chunks, &hit](const auto& chunk) {
+        const std::size_t index = static_cast<std::size_t>(&chunk - chunks.data()) + 1;
+        constexpr difference_type slice = static_cast<difference_type>(_parallel_min_chunk_words) * binary_digits<word_type>::value;
+        for (auto end = chunk.second; end > chunk.first; end -= slice) {
+          if (hit.load(std::memory_order_relaxed) > index) {
+            return;
+          }
+          const auto begin = first + std::max(end - slice, chunk.first);
+          if (bit::find_last(begin, first + end, bv) != first + end) {
+            std::size_t current = hit.load(std::memory_order_relaxed);
+            while (index > current && !hit.compare_exchange_weak(current, index, std::memory_order_relaxed)) {
+            }
+            return;
+          }
+        }
+      });
+  if (hit == 0) {
+    return last;
+  }
+  const auto& chunk = chunks[hit - 1];
+  return bit::find_last(first + chunk.first, first + chunk.second, bv);
+}
+
 // ========================================================================== //
 } // namespace bit
 #ifdef BITLIB_HWY
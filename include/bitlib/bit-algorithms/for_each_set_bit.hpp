@@ -0,0 +1,83 @@
+// ============================ FOR EACH SET BIT ============================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        for_each_set_bit.hpp
+// Description: Calls a function with the index of every set bit of a range
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_FOR_EACH_SET_BIT_HPP_INCLUDED
+#define _BIT_FOR_EACH_SET_BIT_HPP_INCLUDED
+
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+
+namespace bit {
+
+/**
+ * @brief Calls f(i) for the index i, relative to first, of every set bit
+ *        in [first, last), in increasing order
+ *
+ * Each storage word is loaded once and decoded with countr_zero and
+ * w &= w - 1, so the cost is one step per set bit plus one per word.
+ *
+ * @return f
+ */
+template <typename RandomAccessIt, typename Function>
+constexpr Function for_each_set_bit(
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    Function f) {
+  using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+
+  _assert_range_viability(first, last);
+  const auto segments = words(first, last);
+  for (auto it = segments.begin(); it != segments.end(); ++it) {
+    const auto segment = *it;
+    const size_type base = it.offset() - segment.position();
+    for (auto w = static_cast<uword_type>(segment.word & segment.mask); w; w &= static_cast<uword_type>(w - 1)) {
+      f(base + static_cast<size_type>(std::countr_zero(w)));
+    }
+  }
+  return f;
+}
+
+/**
+ * @brief Calls f(i) for the index i, relative to first, of every set bit
+ *        in [first, last), in decreasing order
+ *
+ * @return f
+ */
+template <typename RandomAccessIt, typename Function>
+constexpr Function for_each_set_bit_backward(
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    Function f) {
+  using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  _assert_range_viability(first, last);
+  const auto segments = words(first, last);
+  for (auto it = segments.end(); it != segments.begin();) {
+    --it;
+    const auto segment = *it;
+    const size_type base = it.offset() - segment.position();
+    for (auto w = static_cast<uword_type>(segment.word & segment.mask); w;) {
+      const size_type top = digits - 1 - static_cast<size_type>(std::countl_zero(w));
+      f(base + top);
+      w ^= static_cast<uword_type>(uword_type{1} << top);
+    }
+  }
+  return f;
+}
+
+}  // namespace bit
+
+#endif  // _BIT_FOR_EACH_SET_BIT_HPP_INCLUDED
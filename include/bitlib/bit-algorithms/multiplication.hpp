@@ -11,13 +11,24 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <algorithm>
+#include <cstdint>
 #include <type_traits>
+#include <vector>
 #include <math.h>
 // Project sources
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-algorithms/fill.hpp"
 #include "bitlib/bit-algorithms/transform.hpp"
 #include "bitlib/bit-containers/bit_bitsof.hpp"
 #include "bitlib/bit-iterator/bit_iterator.hpp"
 
+// Operand size (in 64 bit limbs) at which range multiplication switches
+// from schoolbook to Karatsuba
+#ifndef BITLIB_KARATSUBA_THRESHOLD
+#define BITLIB_KARATSUBA_THRESHOLD 32
+#endif
+
 namespace bit {
 
 template <typename It, typename U>
@@ -53,6 +64,178 @@ constexpr typename bit_iterator<It>::word_type multiplication(
   return multiplication(first, last, first, integral_operand);
 }
 
+namespace detail {
+
+using limb_type = std::uint64_t;
+
+// r[0, n) += a[0, na), na <= n. Returns the carry out of r[n - 1]
+inline unsigned char limbs_add_in_place(limb_type* r, std::size_t n, const limb_type* a, std::size_t na) {
+  unsigned char carry = 0;
+  std::size_t i = 0;
+  for (; i < na; ++i) {
+    carry = add_carry(carry, r[i], a[i], &r[i]);
+  }
+  for (; carry && i < n; ++i) {
+    carry = add_carry(carry, r[i], limb_type{0}, &r[i]);
+  }
+  return carry;
+}
+
+// r[0, n) -= a[0, na), na <= n. Returns the borrow out of r[n - 1]
+inline unsigned char limbs_sub_in_place(limb_type* r, std::size_t n, const limb_type* a, std::size_t na) {
+  unsigned char borrow = 0;
+  std::size_t i = 0;
+  for (; i < na; ++i) {
+    borrow = sub_borrow(borrow, r[i], a[i], &r[i]);
+  }
+  for (; borrow && i < n; ++i) {
+    borrow = sub_borrow(borrow, r[i], limb_type{0}, &r[i]);
+  }
+  return borrow;
+}
+
+// r[0, na + nb) = a * b
+inline void limbs_mul_schoolbook(
+    const limb_type* a, std::size_t na,
+    const limb_type* b, std::size_t nb,
+    limb_type* r) {
+  std::fill(r, r + na + nb, limb_type{0});
+  for (std::size_t j = 0; j < nb; ++j) {
+    limb_type carry = 0;
+    for (std::size_t i = 0; i < na; ++i) {
+      limb_type hi;
+      limb_type lo = _mulx(a[i], b[j], &hi);
+      hi += add_carry(0, lo, carry, &lo);
+      hi += add_carry(0, r[i + j], lo, &r[i + j]);
+      carry = hi;
+    }
+    r[na + j] = carry;
+  }
+}
+
+// r[0, na + nb) = a * b, Karatsuba above BITLIB_KARATSUBA_THRESHOLD limbs
+inline void limbs_mul(
+    const limb_type* a, std::size_t na,
+    const limb_type* b, std::size_t nb,
+    limb_type* r) {
+  if (na < nb) {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  if (nb < BITLIB_KARATSUBA_THRESHOLD) {
+    limbs_mul_schoolbook(a, na, b, nb, r);
+    return;
+  }
+  if (na >= 2 * nb) {
+    // Unbalanced: multiply b by nb sized slices of a
+    std::fill(r, r + na + nb, limb_type{0});
+    std::vector<limb_type> partial(2 * nb);
+    for (std::size_t offset = 0; offset < na; offset += nb) {
+      const std::size_t n = std::min(nb, na - offset);
+      limbs_mul(a + offset, n, b, nb, partial.data());
+      limbs_add_in_place(r + offset, na + nb - offset, partial.data(), n + nb);
+    }
+    return;
+  }
+
+  // a = a1 * B^m + a0, b = b1 * B^m + b0
+  // a * b = z2 * B^2m + ((a0 + a1)(b0 + b1) - z2 - z0) * B^m + z0
+  const std::size_t m = na / 2;
+  const limb_type* a0 = a;
+  const limb_type* a1 = a + m;
+  const limb_type* b0 = b;
+  const limb_type* b1 = b + m;
+  const std::size_t na1 = na - m;
+  const std::size_t nb1 = nb - m;
+
+  const auto sum = [](const limb_type* x, std::size_t nx, const limb_type* y, std::size_t ny) {
+    if (nx < ny) {
+      std::swap(x, y);
+      std::swap(nx, ny);
+    }
+    std::vector<limb_type> result(x, x + nx);
+    result.push_back(limbs_add_in_place(result.data(), nx, y, ny));
+    return result;
+  };
+  const std::vector<limb_type> sa = sum(a0, m, a1, na1);
+  const std::vector<limb_type> sb = sum(b0, m, b1, nb1);
+
+  std::vector<limb_type> z1(sa.size() + sb.size());
+  limbs_mul(sa.data(), sa.size(), sb.data(), sb.size(), z1.data());
+
+  // z0 and z2 go straight to their place in the result
+  limbs_mul(a0, m, b0, m, r);
+  limbs_mul(a1, na1, b1, nb1, r + 2 * m);
+  limbs_sub_in_place(z1.data(), z1.size(), r, 2 * m);
+  limbs_sub_in_place(z1.data(), z1.size(), r + 2 * m, na1 + nb1);
+
+  std::size_t nz1 = z1.size();
+  while (nz1 > 0 && z1[nz1 - 1] == 0) {
+    --nz1;
+  }
+  limbs_add_in_place(r + m, na + nb - m, z1.data(), nz1);
+}
+
+// Packs the n bits at first into 64 bit limbs
+template <typename It>
+std::vector<limb_type> gather_limbs(bit_iterator<It> first, std::size_t n) {
+  using word_type = std::remove_cvref_t<typename bit_iterator<It>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  constexpr std::size_t digits = bitsof<word_type>();
+  constexpr std::size_t limb_digits = bitsof<limb_type>();
+
+  std::vector<limb_type> limbs((n + limb_digits - 1) / limb_digits, 0);
+  for (std::size_t pos = 0; pos < n; pos += digits) {
+    const std::size_t len = std::min(digits, n - pos);
+    const limb_type word = static_cast<uword_type>(
+        (len < digits) ? get_masked_word<word_type>(first, len) : get_word<word_type>(first, len));
+    limbs[pos / limb_digits] |= word << (pos % limb_digits);
+    advance(first, len);
+  }
+  return limbs;
+}
+
+// Writes the low n bits of the limbs to d_first
+template <typename It>
+bit_iterator<It> scatter_limbs(const std::vector<limb_type>& limbs, bit_iterator<It> d_first, std::size_t n) {
+  using word_type = std::remove_cvref_t<typename bit_iterator<It>::word_type>;
+  constexpr std::size_t digits = bitsof<word_type>();
+  constexpr std::size_t limb_digits = bitsof<limb_type>();
+
+  for (std::size_t pos = 0; pos < n; pos += digits) {
+    const std::size_t len = std::min(digits, n - pos);
+    write_word<word_type>(static_cast<word_type>(limbs[pos / limb_digits] >> (pos % limb_digits)), d_first, len);
+    advance(d_first, len);
+  }
+  return d_first;
+}
+
+}  // namespace detail
+
+// Multiplies the unsigned integers [first1, last1) and [first2, last2) and
+// writes the full width product (distance1 + distance2 bits) to d_first.
+// The operands are read before the product is written, so d_first may alias them.
+// Returns the end of the product.
+template <typename It1, typename It2, typename OutIt>
+bit_iterator<OutIt> multiplication(
+    const bit_iterator<It1>& first1,
+    const bit_iterator<It1>& last1,
+    const bit_iterator<It2>& first2,
+    const bit_iterator<It2>& last2,
+    const bit_iterator<OutIt>& d_first) {
+  const std::size_t n1 = distance(first1, last1);
+  const std::size_t n2 = distance(first2, last2);
+  if (n1 == 0 || n2 == 0) {
+    fill(d_first, d_first + (n1 + n2), bit0);
+    return d_first + (n1 + n2);
+  }
+  const std::vector<detail::limb_type> a = detail::gather_limbs(first1, n1);
+  const std::vector<detail::limb_type> b = detail::gather_limbs(first2, n2);
+  std::vector<detail::limb_type> product(a.size() + b.size());
+  detail::limbs_mul(a.data(), a.size(), b.data(), b.size(), product.data());
+  return detail::scatter_limbs(product, d_first, n1 + n2);
+}
+
 } // namespace bit
 
 #endif  // _MULTIPLICATION_HPP_INCLUDED
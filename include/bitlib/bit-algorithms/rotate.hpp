@@ -13,7 +13,9 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <climits>
 #include <iostream>
+#include <memory>
 // Project sources
 #include "bit_algorithm.hpp"
 // Third-party libraries
@@ -97,6 +99,54 @@ bit_iterator<ForwardIt> _rotate_via_copy_end(
     return ret;
 }
 
+// Largest scratch buffer, in bytes, that rotate allocates. Beyond it the
+// in-place block swap of _rotate_via_raw is used instead.
+inline constexpr std::size_t _rotate_max_scratch_bytes = std::size_t{16} << 20;
+
+// Rotates a range by moving the shorter side into scratch words taken from
+// alloc, shifting the longer side over it, then copying the scratch back.
+// The longer side is moved once and the shorter twice, so memory is
+// traversed at most 1.5 times and every move is word-level.
+template <class RandomAccessIt, class Allocator>
+bit_iterator<RandomAccessIt> _rotate_via_buffer(
+   bit_iterator<RandomAccessIt> first,
+   bit_iterator<RandomAccessIt> n_first,
+   bit_iterator<RandomAccessIt> last,
+   Allocator alloc
+) {
+    // Types and constants
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+    using traits = std::allocator_traits<Allocator>;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    const size_type k = distance(first, n_first);
+    const size_type p = distance(n_first, last);
+    const bool save_begin = k <= p;
+    const bit_iterator<RandomAccessIt> src = save_begin ? first : n_first;
+    const size_type len = save_begin ? k : p;
+
+    // The scratch copy keeps the source bit offset so both copies stay
+    // word-aligned on one side
+    const size_type words = (src.position() + len + digits - 1) / digits;
+    word_type* const scratch = traits::allocate(alloc, words);
+    // copy blends the bits around [position, position + len) into the head
+    // and tail words, so they must hold defined values
+    std::uninitialized_value_construct_n(scratch, words);
+    const bit_iterator<word_type*> buf(scratch, src.position());
+    copy(src, src + len, buf);
+    bit_iterator<RandomAccessIt> ret;
+    if (save_begin) {
+        ret = shift_left(first, last, k);
+        copy(buf, buf + len, ret);
+    } else {
+        ret = shift_right(first, last, p);
+        copy(buf, buf + len, first);
+    }
+    traits::deallocate(alloc, scratch, words);
+    return ret;
+}
+
 // Rotates a range using random-access iterators. Algorithm logic from the GCC
 // implementation
 template <class RandomAccessIt>
@@ -180,12 +230,14 @@ bit_iterator<RandomAccessIt> _rotate_via_raw(
     }
 }
 
-// Main function for implementing the bit overload of std::rotate.
-template <class ForwardIt>
+// Main function for implementing the bit overload of std::rotate. Scratch
+// words for large rotations are taken from alloc, rebound to the word type.
+template <class ForwardIt, class Allocator>
 bit_iterator<ForwardIt> rotate(
    bit_iterator<ForwardIt> first,
    bit_iterator<ForwardIt> n_first,
-   bit_iterator<ForwardIt> last
+   bit_iterator<ForwardIt> last,
+   const Allocator& alloc
 ) {
     // Assertions
     _assert_range_viability(first, n_first);
@@ -245,6 +297,11 @@ bit_iterator<ForwardIt> rotate(
         write_word(temp, first, static_cast<word_type>(p));
         return new_last;
     }
+    if (static_cast<std::size_t>(std::min(distance(first, n_first), distance(n_first, last)))
+            <= _rotate_max_scratch_bytes * CHAR_BIT) {
+        using word_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<word_type>;
+        return _rotate_via_buffer(first, n_first, last, word_allocator(alloc));
+    }
     return _rotate_via_raw(
             first,
             n_first,
@@ -253,6 +310,16 @@ bit_iterator<ForwardIt> rotate(
     );
 }
 
+template <class ForwardIt>
+bit_iterator<ForwardIt> rotate(
+   bit_iterator<ForwardIt> first,
+   bit_iterator<ForwardIt> n_first,
+   bit_iterator<ForwardIt> last
+) {
+    using word_type = typename bit_iterator<ForwardIt>::word_type;
+    return rotate(first, n_first, last, std::allocator<word_type>());
+}
+
 
 // ========================================================================== //
 } // namespace bit
@@ -185,6 +185,15 @@ bit_iterator<RandomAccessIt> shift_left(
     auto first_base = first.base();
     auto middle_base = middle.base();
 
+    if constexpr (std::contiguous_iterator<RandomAccessIt>) {
+      // One funnel pass over the words, moved as they are shifted
+      const auto words = std::distance(middle_base, last.base()) - 1;
+      if (words > 0) {
+        _shift_words_forward(std::to_address(first_base), std::to_address(middle_base), words, offset);
+        first_base += words;
+        middle_base += words;
+      }
+    }
     while (std::next(middle_base) < last.base()) {
       *first_base = _shrd<word_type>(*middle_base, *std::next(middle_base), offset);
       first_base++;
@@ -321,6 +330,18 @@ bit_iterator<RandomAccessIt> shift_right(
     auto last_base_prev = std::prev(last.base());
     auto middle_base_prev = std::prev(middle.base());
 
+    if constexpr (std::contiguous_iterator<RandomAccessIt>) {
+      const auto words = std::distance(first.base(), middle_base_prev);
+      if (words > 0) {
+        _shift_words_backward(
+            std::to_address(last_base_prev) - (words - 1),
+            std::to_address(first.base()) + 1,
+            words,
+            offset);
+        last_base_prev -= words;
+        middle_base_prev -= words;
+      }
+    }
     while (middle_base_prev > first.base()) {
       *last_base_prev = _shrd<word_type>(*middle_base_prev, *std::next(middle_base_prev), offset);
       last_base_prev--;
@@ -0,0 +1,176 @@
+// =============================== STREAMING ================================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        streaming.hpp
+// Description: Cache-bypassing word stores for large fill and copy
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_STREAMING_HPP_INCLUDED
+#define _BIT_STREAMING_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "bitlib/bit-iterator/bit.hpp"
+
+// Bytes of whole words at which fill and copy switch to non-temporal
+// stores when no store policy is given. Larger than a typical last level
+// cache, so a range this size would evict the working set anyway.
+#ifndef BITLIB_STREAMING_THRESHOLD
+#define BITLIB_STREAMING_THRESHOLD (std::size_t{32} << 20)
+#endif
+
+namespace bit {
+
+namespace policy {
+
+// Store policies for fill and copy: streaming always bypasses the cache,
+// cached never does. Without one, ranges of BITLIB_STREAMING_THRESHOLD
+// bytes or more are streamed.
+struct streaming_t {
+  explicit streaming_t() = default;
+};
+struct cached_t {
+  explicit cached_t() = default;
+};
+inline constexpr streaming_t streaming{};
+inline constexpr cached_t cached{};
+
+}  // namespace policy
+
+namespace detail {
+
+enum class store_mode {
+  automatic,
+  streaming,
+  cached
+};
+
+template <class WordType>
+constexpr bool use_streaming(store_mode mode, std::size_t words) noexcept {
+  return mode == store_mode::streaming ||
+         (mode == store_mode::automatic && words * sizeof(WordType) >= BITLIB_STREAMING_THRESHOLD);
+}
+
+#if defined(__AVX__)
+using stream_vector = __m256i;
+#elif defined(__SSE2__)
+using stream_vector = __m128i;
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__)
+inline stream_vector stream_load(const void* p) noexcept {
+#if defined(__AVX__)
+  return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+#else
+  return _mm_loadu_si128(static_cast<const __m128i*>(p));
+#endif
+}
+
+inline void stream_store(void* p, stream_vector v) noexcept {
+#if defined(__AVX__)
+  _mm256_stream_si256(static_cast<__m256i*>(p), v);
+#else
+  _mm_stream_si128(static_cast<__m128i*>(p), v);
+#endif
+}
+
+// Advances dst past the words before the first vector-aligned address and
+// returns the number of whole vectors in the n words left
+template <class WordType>
+std::size_t stream_head(WordType*& dst, std::size_t& n) noexcept {
+  while (n && reinterpret_cast<std::uintptr_t>(dst) % sizeof(stream_vector)) {
+    --n;
+    ++dst;
+  }
+  return n / (sizeof(stream_vector) / sizeof(WordType));
+}
+#endif
+
+// Writes n copies of value to dst with non-temporal stores. Vector stores
+// must be aligned, so the head and tail words go through the cache.
+template <class WordType>
+void stream_fill(WordType* dst, std::size_t n, WordType value) noexcept {
+#if defined(__AVX__) || defined(__SSE2__)
+  if constexpr (sizeof(stream_vector) % sizeof(WordType) == 0) {
+    constexpr std::size_t lanes = sizeof(stream_vector) / sizeof(WordType);
+    WordType* const first = dst;
+    const std::size_t vectors = stream_head(dst, n);
+    std::fill(first, dst, value);
+    WordType pattern[lanes];
+    std::fill_n(pattern, lanes, value);
+    const stream_vector v = stream_load(pattern);
+    for (std::size_t i = 0; i < vectors; ++i, dst += lanes) {
+      stream_store(dst, v);
+    }
+    _mm_sfence();
+    n -= vectors * lanes;
+  }
+#endif
+  std::fill_n(dst, n, value);
+}
+
+// Copies n words from src to dst with non-temporal stores. Loads are plain
+// unaligned loads with no software prefetch.
+template <class WordType>
+void stream_copy(const WordType* src, std::size_t n, WordType* dst) noexcept {
+#if defined(__AVX__) || defined(__SSE2__)
+  if constexpr (sizeof(stream_vector) % sizeof(WordType) == 0) {
+    constexpr std::size_t lanes = sizeof(stream_vector) / sizeof(WordType);
+    WordType* const first = dst;
+    const std::size_t vectors = stream_head(dst, n);
+    std::copy(src, src + (dst - first), first);
+    src += dst - first;
+    for (std::size_t i = 0; i < vectors; ++i, src += lanes, dst += lanes) {
+      stream_store(dst, stream_load(src));
+    }
+    _mm_sfence();
+    n -= vectors * lanes;
+  }
+#endif
+  std::copy_n(src, n, dst);
+}
+
+}  // namespace detail
+
+// Fills the words [first, last), streaming them when Mode allows
+template <detail::store_mode Mode, class WordIt, class WordType>
+constexpr void _fill_words(WordIt first, WordIt last, WordType value) {
+  using word_type = std::iter_value_t<WordIt>;
+  if constexpr (std::contiguous_iterator<WordIt> && !std::is_const_v<std::remove_reference_t<std::iter_reference_t<WordIt>>>) {
+    if !consteval {
+      const auto n = static_cast<std::size_t>(std::distance(first, last));
+      if (detail::use_streaming<word_type>(Mode, n)) {
+        detail::stream_fill(std::to_address(first), n, static_cast<word_type>(value));
+        return;
+      }
+    }
+  }
+  std::fill(first, last, static_cast<word_type>(value));
+}
+
+// Copies the words [first, last) to d_first, streaming them when Mode allows
+template <detail::store_mode Mode, class SrcIt, class DstIt>
+constexpr DstIt _copy_words(SrcIt first, SrcIt last, DstIt d_first) {
+  using word_type = std::iter_value_t<DstIt>;
+  if constexpr (std::contiguous_iterator<SrcIt> && std::contiguous_iterator<DstIt> &&
+                std::is_same_v<std::iter_value_t<SrcIt>, word_type> &&
+                !std::is_const_v<std::remove_reference_t<std::iter_reference_t<DstIt>>>) {
+    if !consteval {
+      const auto n = static_cast<std::size_t>(std::distance(first, last));
+      if (detail::use_streaming<word_type>(Mode, n)) {
+        detail::stream_copy(std::to_address(first), n, std::to_address(d_first));
+        return std::next(d_first, n);
+      }
+    }
+  }
+  return std::copy(first, last, d_first);
+}
+
+}  // namespace bit
+
+#endif  // _BIT_STREAMING_HPP_INCLUDED
@@ -0,0 +1,78 @@
+// =============================== SUBTRACTION ============================== //
+// Project: The Experimental Bit Algorithms Library
+// Name: subtraction.hpp
+// Description: bit range subtraction
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SUBTRACTION_HPP_INCLUDED
+#define _SUBTRACTION_HPP_INCLUDED
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <type_traits>
+#include <utility>
+// Project sources
+#include "bitlib/bit-algorithms/addition.hpp"
+#include "bitlib/bit-containers/bit_bitsof.hpp"
+#include "bitlib/bit-iterator/bit_details.hpp"
+#include "bitlib/bit-iterator/bit_iterator.hpp"
+
+namespace bit {
+
+template <typename It, typename U>
+  requires(
+      (is_static_castable_v<U, typename bit_iterator<It>::word_type>) &&
+      (bitsof<U>() <= bitsof<typename bit_iterator<It>::word_type>()))
+constexpr unsigned char subtraction(
+    const bit_iterator<It>& first,
+    const bit_iterator<It>& last,
+    const bit_iterator<It>& d_first,
+    const U& integral_operand) {
+  using word_type = std::remove_cvref_t<typename bit_iterator<It>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  // The operand only applies to the least significant word
+  uword_type operand = static_cast<uword_type>(static_cast<word_type>(integral_operand));
+  return detail::add_sub_chain<false>(first, last, d_first, [&operand](auto) {
+    return std::exchange(operand, uword_type{0});
+  });
+}
+
+template <typename It, typename U>
+  requires(
+      (is_static_castable_v<U, typename bit_iterator<It>::word_type>) &&
+      (bitsof<U>() <= bitsof<typename bit_iterator<It>::word_type>()))
+constexpr unsigned char subtraction(
+    const bit_iterator<It>& first,
+    const bit_iterator<It>& last,
+    const U& integral_operand) {
+  return subtraction(first, last, first, integral_operand);
+}
+
+// Subtracts [first2, ...) from the equally sized range [first1, last1) into d_first.
+// Returns the borrow out of the most significant bit.
+template <typename It1, typename It2, typename OutIt>
+  requires(
+      std::is_same_v<std::remove_cvref_t<typename bit_iterator<It1>::word_type>,
+                     std::remove_cvref_t<typename bit_iterator<It2>::word_type>> &&
+      std::is_same_v<std::remove_cvref_t<typename bit_iterator<It1>::word_type>,
+                     std::remove_cvref_t<typename bit_iterator<OutIt>::word_type>>)
+constexpr unsigned char subtraction(
+    const bit_iterator<It1>& first1,
+    const bit_iterator<It1>& last1,
+    bit_iterator<It2> first2,
+    const bit_iterator<OutIt>& d_first) {
+  using word_type = std::remove_cvref_t<typename bit_iterator<It1>::word_type>;
+  return detail::add_sub_chain<false>(first1, last1, d_first, [&first2](auto bits) {
+    const word_type word = (bits < bitsof<word_type>())
+                               ? get_masked_word<word_type>(first2, bits)
+                               : get_word<word_type>(first2, bits);
+    advance(first2, bits);
+    return word;
+  });
+}
+
+} // namespace bit
+
+#endif  // _SUBTRACTION_HPP_INCLUDED
@@ -12,9 +12,11 @@
 
 #include <array>
 #include <bit>
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "bitlib/bit-algorithms/accumulate.hpp"
 #include "bitlib/bit-algorithms/count.hpp"
@@ -23,6 +25,12 @@
 #include "bitlib/bit-containers/bit_policy.hpp"
 #include "bitlib/bit_concepts.hpp"
 
+// Size (in 64 bit limbs) below which decimal to_string divides by 10^19
+// once per 19 digits instead of splitting by larger powers of ten
+#ifndef BITLIB_DECIMAL_SPLIT_THRESHOLD
+#define BITLIB_DECIMAL_SPLIT_THRESHOLD 256
+#endif
+
 namespace bit {
 
 namespace string {
@@ -122,6 +130,10 @@ constexpr auto make_from_digit_map(std::size_t Base) {
   }
 }
 
+// Largest power of ten that fits in a 64 bit limb
+constexpr std::uint64_t decimal_chunk = 10'000'000'000'000'000'000ull;
+constexpr std::size_t decimal_chunk_digits = 19;
+
 struct metadata_t {
   size_t base;
   bool is_signed;
@@ -141,6 +153,276 @@ constexpr metadata_t typical(size_t base = 10, bool str_sign_extend_zeros = fals
 
 }  // namespace string
 
+namespace detail {
+
+inline void trim_limbs(std::vector<limb_type>& limbs) {
+  while (!limbs.empty() && limbs.back() == 0) {
+    limbs.pop_back();
+  }
+}
+
+// Converts decimal digit values (most significant first) to 64 bit limbs.
+// The 19 digit chunks are combined pairwise with the precomputed powers
+// 10^(19 * 2^k), so the cost is dominated by a few large multiplications.
+inline std::vector<limb_type> decimal_to_limbs(const std::vector<unsigned char>& digits) {
+  // Base 10^19 chunks, least significant first
+  std::vector<std::vector<limb_type>> parts;
+  for (size_t end = digits.size(); end > 0;) {
+    const size_t begin = (end > string::decimal_chunk_digits) ? end - string::decimal_chunk_digits : 0;
+    limb_type chunk = 0;
+    for (size_t i = begin; i < end; ++i) {
+      chunk = chunk * 10 + digits[i];
+    }
+    parts.push_back({chunk});
+    trim_limbs(parts.back());
+    end = begin;
+  }
+  if (parts.empty()) {
+    return {};
+  }
+
+  std::vector<limb_type> power{string::decimal_chunk};
+  while (parts.size() > 1) {
+    std::vector<std::vector<limb_type>> next;
+    for (size_t i = 0; i + 1 < parts.size(); i += 2) {
+      const std::vector<limb_type>& lo = parts[i];
+      const std::vector<limb_type>& hi = parts[i + 1];
+      std::vector<limb_type> combined(hi.size() + power.size());
+      limbs_mul(hi.data(), hi.size(), power.data(), power.size(), combined.data());
+      limbs_add_in_place(combined.data(), combined.size(), lo.data(), lo.size());
+      trim_limbs(combined);
+      next.push_back(std::move(combined));
+    }
+    if (parts.size() % 2) {
+      next.push_back(std::move(parts.back()));
+    }
+    parts = std::move(next);
+    if (parts.size() > 1) {
+      std::vector<limb_type> square(2 * power.size());
+      limbs_mul(power.data(), power.size(), power.data(), power.size(), square.data());
+      trim_limbs(square);
+      power = std::move(square);
+    }
+  }
+  return parts.front();
+}
+
+// Three-way comparison of two limb sequences, ignoring high zero limbs
+inline int limbs_compare(const limb_type* a, std::size_t na, const limb_type* b, std::size_t nb) {
+  while (na && a[na - 1] == 0) {
+    --na;
+  }
+  while (nb && b[nb - 1] == 0) {
+    --nb;
+  }
+  if (na != nb) {
+    return (na < nb) ? -1 : 1;
+  }
+  for (std::size_t i = na; i-- > 0;) {
+    if (a[i] != b[i]) {
+      return (a[i] < b[i]) ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+inline std::vector<limb_type> limbs_product(const std::vector<limb_type>& a, const std::vector<limb_type>& b) {
+  if (a.empty() || b.empty()) {
+    return {};
+  }
+  std::vector<limb_type> product(a.size() + b.size());
+  limbs_mul(a.data(), a.size(), b.data(), b.size(), product.data());
+  trim_limbs(product);
+  return product;
+}
+
+// floor(B^(2m) / d) for d of m limbs with a non-zero top limb, B = 2^64.
+// The reciprocal of the top half of d, scaled up, is an underestimate good
+// to about m / 2 limbs; one Newton step x += x * (B^(2m) - d * x) / B^(2m)
+// doubles that and stays below, leaving a few units to correct. The cost
+// is a few m limb multiplications.
+inline std::vector<limb_type> limbs_reciprocal(const std::vector<limb_type>& d) {
+  const std::size_t m = d.size();
+  const std::size_t h = m / 2 + 2;
+  std::vector<limb_type> x;
+  if (h >= m) {
+    // Binary long division of B^(2m) for the last few limbs
+    x.assign(2 * m + 1, 0);
+    std::vector<limb_type> r(m + 1, 0);
+    for (std::size_t pos = 2 * m * bitsof<limb_type>() + 1; pos-- > 0;) {
+      for (std::size_t i = m + 1; i-- > 1;) {
+        r[i] = (r[i] << 1) | (r[i - 1] >> (bitsof<limb_type>() - 1));
+      }
+      r[0] = (r[0] << 1) | (pos == 2 * m * bitsof<limb_type>());
+      if (limbs_compare(r.data(), r.size(), d.data(), m) >= 0) {
+        limbs_sub_in_place(r.data(), r.size(), d.data(), m);
+        x[pos / bitsof<limb_type>()] |= limb_type{1} << (pos % bitsof<limb_type>());
+      }
+    }
+    trim_limbs(x);
+    return x;
+  }
+
+  // x = floor(B^(2h) / (d_hi + 1)) * B^(m - h) <= B^(2m) / d
+  std::vector<limb_type> top(d.end() - h, d.end());
+  const limb_type one = 1;
+  if (limbs_add_in_place(top.data(), h, &one, 1)) {
+    x.assign(m + 1, 0);
+    x[m] = 1;
+  } else {
+    x = limbs_reciprocal(top);
+    x.insert(x.begin(), m - h, limb_type{0});
+  }
+
+  std::vector<limb_type> e(2 * m + 1, 0);
+  e[2 * m] = 1;
+  const std::vector<limb_type> dx = limbs_product(d, x);
+  limbs_sub_in_place(e.data(), e.size(), dx.data(), dx.size());
+  trim_limbs(e);
+  const std::vector<limb_type> xe = limbs_product(x, e);
+  if (xe.size() > 2 * m) {
+    x.push_back(0);
+    limbs_add_in_place(x.data(), x.size(), xe.data() + 2 * m, xe.size() - 2 * m);
+    trim_limbs(x);
+  }
+
+  std::vector<limb_type> r(2 * m + 1, 0);
+  r[2 * m] = 1;
+  const std::vector<limb_type> dx1 = limbs_product(d, x);
+  limbs_sub_in_place(r.data(), r.size(), dx1.data(), dx1.size());
+  while (limbs_compare(r.data(), r.size(), d.data(), m) >= 0) {
+    limbs_sub_in_place(r.data(), r.size(), d.data(), m);
+    x.push_back(0);
+    limbs_add_in_place(x.data(), x.size(), &one, 1);
+    trim_limbs(x);
+  }
+  return x;
+}
+
+// q = x / d and r = x % d by Barrett reduction, for x < B^(2m) where d has
+// m limbs and mu = limbs_reciprocal(d). The estimate is at most 2 short.
+inline void limbs_divmod_barrett(
+    const std::vector<limb_type>& x,
+    const std::vector<limb_type>& d,
+    const std::vector<limb_type>& mu,
+    std::vector<limb_type>& q,
+    std::vector<limb_type>& r) {
+  const std::size_t m = d.size();
+  q.clear();
+  if (x.size() >= m) {
+    q = limbs_product(std::vector<limb_type>(x.begin() + (m - 1), x.end()), mu);
+    q.erase(q.begin(), q.begin() + std::min(q.size(), m + 1));
+  }
+  r = x;
+  const std::vector<limb_type> qd = limbs_product(q, d);
+  limbs_sub_in_place(r.data(), r.size(), qd.data(), qd.size());
+  trim_limbs(r);
+  const limb_type one = 1;
+  while (limbs_compare(r.data(), r.size(), d.data(), m) >= 0) {
+    limbs_sub_in_place(r.data(), r.size(), d.data(), m);
+    trim_limbs(r);
+    q.push_back(0);
+    limbs_add_in_place(q.data(), q.size(), &one, 1);
+    trim_limbs(q);
+  }
+}
+
+// q = x / d and r = x % d for any x, one Barrett reduction per m limbs of x
+// from the top
+inline void limbs_divmod(
+    const std::vector<limb_type>& x,
+    const std::vector<limb_type>& d,
+    const std::vector<limb_type>& mu,
+    std::vector<limb_type>& q,
+    std::vector<limb_type>& r) {
+  const std::size_t m = d.size();
+  const std::size_t blocks = (x.size() + m - 1) / m;
+  q.assign(blocks * m, 0);
+  r.clear();
+  std::vector<limb_type> partial;
+  std::vector<limb_type> qi;
+  for (std::size_t i = blocks; i-- > 0;) {
+    // partial = r * B^m + block i < d * B^m
+    partial.assign(x.begin() + i * m, x.begin() + std::min(x.size(), (i + 1) * m));
+    partial.resize(m, 0);
+    partial.insert(partial.end(), r.begin(), r.end());
+    trim_limbs(partial);
+    limbs_divmod_barrett(partial, d, mu, qi, r);
+    std::copy(qi.begin(), qi.end(), q.begin() + i * m);
+  }
+  trim_limbs(q);
+}
+
+// Writes x as count base 10^19 chunks, least significant first, by
+// dividing by 10^19 once per chunk
+inline void limbs_to_decimal_schoolbook(std::vector<limb_type> x, limb_type* out, std::size_t count) {
+  std::size_t n = x.size();
+  for (std::size_t c = 0; c < count; ++c) {
+    while (n && x[n - 1] == 0) {
+      --n;
+    }
+    limb_type remainder = 0;
+    for (std::size_t i = n; i-- > 0;) {
+      limb_type next_remainder;
+      x[i] = _divx(remainder, x[i], string::decimal_chunk, &next_remainder);
+      remainder = next_remainder;
+    }
+    out[c] = remainder;
+  }
+}
+
+struct decimal_powers {
+  // powers[k] = 10^(19 * 2^k) and its limbs_reciprocal, computed on first use
+  std::vector<std::vector<limb_type>> powers;
+  std::vector<std::vector<limb_type>> reciprocals;
+};
+
+// Writes x < 10^(19 * count) as count base 10^19 chunks, least significant
+// first. x is split by the largest 10^(19 * 2^k) with 2^k <= count / 2, so
+// neither part has more than 3/4 of the chunks, until the parts are small
+// enough to peel.
+inline void limbs_to_decimal(const std::vector<limb_type>& x, decimal_powers& table, std::size_t count, limb_type* out) {
+  if (count < 2 || x.size() < BITLIB_DECIMAL_SPLIT_THRESHOLD) {
+    limbs_to_decimal_schoolbook(x, out, count);
+    return;
+  }
+  const std::size_t k = static_cast<std::size_t>(std::bit_width(count / 2)) - 1;
+  if (table.reciprocals[k].empty()) {
+    table.reciprocals[k] = limbs_reciprocal(table.powers[k]);
+  }
+  std::vector<limb_type> q;
+  std::vector<limb_type> r;
+  limbs_divmod(x, table.powers[k], table.reciprocals[k], q, r);
+  const std::size_t low = std::size_t{1} << k;
+  limbs_to_decimal(r, table, low, out);
+  limbs_to_decimal(q, table, count - low, out + low);
+}
+
+// Base 10^19 chunks of the limbs, least significant first, without high
+// zero chunks but at least one chunk
+inline std::vector<limb_type> limbs_to_decimal(std::vector<limb_type> limbs) {
+  trim_limbs(limbs);
+  // 10^19 > 2^63, so every 63 bits need at most one chunk
+  const std::size_t bits = limbs.empty() ? 0 : (limbs.size() - 1) * bitsof<limb_type>() + std::bit_width(limbs.back());
+  std::vector<limb_type> chunks(bits / 63 + 1);
+
+  decimal_powers table;
+  table.powers.push_back({string::decimal_chunk});
+  while ((std::size_t{4} << (table.powers.size() - 1)) <= chunks.size()) {
+    const std::vector<limb_type>& power = table.powers.back();
+    table.powers.push_back(limbs_product(power, power));
+  }
+  table.reciprocals.resize(table.powers.size());
+
+  limbs_to_decimal(limbs, table, chunks.size(), chunks.data());
+  while (chunks.size() > 1 && chunks.back() == 0) {
+    chunks.pop_back();
+  }
+  return chunks;
+}
+
+}  // namespace detail
+
 template <typename RandomAccessIt, typename CharIt>
 constexpr CharIt to_string(
     const bit_iterator<RandomAccessIt>& bit_first,
@@ -171,21 +453,23 @@ constexpr CharIt to_string(
       return str_last;
     }
   } else {
-    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
-    size_t store_bits = distance(bit_first, bit_last);
-    std::vector<word_type> vec((store_bits + bitsof<word_type>() - 1) / bitsof<word_type>());
-    vec.back() = 0;  // Ensure last word is zeroed
-    bit_iterator<word_type*> bit_it(vec.data());
-
-    const unsigned char base = static_cast<unsigned char>(meta.base);
-    auto remainder = ::bit::division(bit_first, bit_last, bit_it, base);
+    // 19 decimal digits per base 10^19 chunk
+    const std::vector<detail::limb_type> chunks =
+        detail::limbs_to_decimal(detail::gather_limbs(bit_first, distance(bit_first, bit_last)));
     CharIt cursor = str_last;
-    *(--cursor) = static_cast<char>(remainder + '0');
-
-    while ((cursor != str_first) && (store_bits -= ::bit::count_msb(bit_it, bit_it + store_bits, bit0))) {
-      remainder = ::bit::division(bit_it, bit_it + store_bits, bit_it, base);
-      *(--cursor) = static_cast<char>(remainder + '0');
+    for (size_t i = 0; i < chunks.size() && cursor != str_first; ++i) {
+      detail::limb_type chunk = chunks[i];
+      const bool top = (i + 1 == chunks.size());
+      // Inner chunks are zero padded, the most significant one is not
+      for (size_t d = 0; d < string::decimal_chunk_digits && cursor != str_first; ++d) {
+        *(--cursor) = static_cast<char>('0' + (chunk % 10));
+        chunk /= 10;
+        if (top && chunk == 0) {
+          break;
+        }
+      }
     }
+
     if (cursor != str_first) {
       return std::copy(cursor, str_last, str_first);
     }
@@ -330,25 +614,17 @@ constexpr void from_string(
     if (meta.base != 10) {
       throw std::runtime_error("Base not implemented");
     }
-    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
-    std::vector<word_type> vec;
-
-    // TODO: template with uninitialized_t
-    ::bit::fill(bit_first, bit_last, bit0);  // Clear the bits first
-
-    CharIt cursor = str_first;
-    while (cursor != str_last) {
+    std::vector<unsigned char> digits;
+    for (CharIt cursor = str_first; cursor != str_last; ++cursor) {
       unsigned char c = static_cast<unsigned char>(*cursor - '0');
       if (c <= 9) {
-        auto overflow_mult = ::bit::multiplication(bit_first, bit_last, word_type{10});
-        auto overflow_add = ::bit::addition(bit_first, bit_last, c);
-        if (overflow_mult || overflow_add) {
-          //Policy::truncation::template overflow(bit_first, bit_last);
-          return;
-        }
+        digits.push_back(c);
       }
-      cursor++;
     }
+    const std::vector<detail::limb_type> limbs = detail::decimal_to_limbs(digits);
+    // Any bits that don't fit are truncated
+    const size_t store_bits = std::min<size_t>(distance(bit_first, bit_last), limbs.size() * bitsof<detail::limb_type>());
+    ::bit::fill(detail::scatter_limbs(limbs, bit_first, store_bits), bit_last, bit0);
     //Policy::extension::template extend(bit_first, bit_last);
   }
 }
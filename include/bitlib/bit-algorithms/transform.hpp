@@ -13,6 +13,7 @@
 #include <functional>
 #include <type_traits>
 // Project sources
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
 // Miscellaneous
@@ -50,108 +51,71 @@ constexpr bit_iterator<RandomAccessItOut> transform(
     return d_first;
   }
 
-  // Initialization
-  const bool is_d_first_aligned = d_first.position() == 0;
-  size_type total_bits_to_op = distance(first, last);
-  size_type remaining_bits_to_op = total_bits_to_op;
-  auto it = d_first.base();
-
-  // d_first is not aligned. Copy partial word to align it
-  if (!is_d_first_aligned) {
-    size_type partial_bits_to_op = ::std::min(
-        remaining_bits_to_op,
-        digits - d_first.position());
-    word_type result;
-    if constexpr (std::is_invocable_v<UnaryOperation, word_type, size_type>) {
-      result = unary_op(
-          static_cast<word_type>(
-              get_masked_word<word_type>(first, partial_bits_to_op)
-              << static_cast<word_type>(d_first.position())),
-          partial_bits_to_op);
-    } else {
-      result = unary_op(
-          static_cast<word_type>(
-              get_masked_word<word_type>(first, partial_bits_to_op)
-              << static_cast<word_type>(d_first.position())));
+  // Walk the destination a storage word at a time. Partial head and tail
+  // words are blended in, runs of whole words are written directly.
+  const size_type total_bits_to_op = distance(first, last);
+  const auto segments = words(d_first, d_first + total_bits_to_op);
+  for (auto seg = segments.begin(); seg != segments.end(); ++seg) {
+    const auto segment = *seg;
+    auto it = seg.base();
+    auto in = first + seg.offset();
+    if (!segment.full()) {
+      const size_type bits = segment.size();
+      const word_type in_word = static_cast<word_type>(
+          get_masked_word<word_type>(in, bits) << static_cast<word_type>(segment.position()));
+      word_type result;
+      if constexpr (std::is_invocable_v<UnaryOperation, word_type, size_type>) {
+        result = unary_op(in_word, bits);
+      } else {
+        result = unary_op(in_word);
+      }
+      *it = _bitblend(*it, result, segment.mask);
+      continue;
     }
-    *it = _bitblend(
-        *it,
-        result,
-        static_cast<word_type>(d_first.position()),
-        static_cast<word_type>(partial_bits_to_op));
-    remaining_bits_to_op -= partial_bits_to_op;
-    advance(first, partial_bits_to_op);
-    it++;
-  }
-  auto firstIt = first.base();
-  if (remaining_bits_to_op > 0) {
-    const bool is_first_aligned = first.position() == 0;
-    //size_type words_to_op = ::std::ceil(remaining_bits_to_op / static_cast<float>(digits));
-    // d_first will be aligned at this point
-    if (is_first_aligned && remaining_bits_to_op > digits) {
-      auto N = ::std::distance(firstIt, last.base());
+
+    const size_type N = (total_bits_to_op - seg.offset()) / digits;
+    if (in.position() == 0) {
+      auto firstIt = in.base();
+      const auto lastIt = firstIt + N;
 #ifdef BITLIB_HWY
-            if constexpr (std::is_same_v<UnaryOperation, std::bit_not<word_type>>)
-            {
-                // Align to 64 bit boundary
-                for (; firstIt != last.base() && !is_aligned(&*firstIt, 64); firstIt++, it++) {
-                    *it = unary_op(*firstIt);
-                }
+      if constexpr (std::is_same_v<UnaryOperation, std::bit_not<word_type>>) {
+        // Align to 64 bit boundary
+        for (; firstIt != lastIt && !is_aligned(&*firstIt, 64); firstIt++, it++) {
+          *it = unary_op(*firstIt);
+        }
 
-                bool out_is_aligned = is_aligned(&*it, 64);
+        bool out_is_aligned = is_aligned(&*it, 64);
 
-                constexpr hn::ScalableTag<word_type> d;
-                for (; std::distance(firstIt, last.base()) >= hn::Lanes(d); firstIt += hn::Lanes(d), it += hn::Lanes(d))
-                {
-                    const auto v = hn::Not(hn::Load(d, &*firstIt));
-                    if (out_is_aligned)
-                    {
-                        hn::Store(v, d, &*it);
-                    } else {
-                        hn::StoreU(v, d, &*it);
-                    }
-                }
-            }
+        constexpr hn::ScalableTag<word_type> d;
+        for (; std::distance(firstIt, lastIt) >= hn::Lanes(d); firstIt += hn::Lanes(d), it += hn::Lanes(d)) {
+          const auto v = hn::Not(hn::Load(d, &*firstIt));
+          if (out_is_aligned) {
+            hn::Store(v, d, &*it);
+          } else {
+            hn::StoreU(v, d, &*it);
+          }
+        }
+      }
 #endif
-            size_t std_dist = ::std::distance(firstIt, last.base());
-            for (auto in_it = firstIt; in_it != last.base(); std::advance(in_it, 1), std::advance(it, 1)) {
-              if constexpr (std::is_invocable_v<UnaryOperation, word_type, size_type>) {
-                *it = unary_op(*in_it, digits);
-              } else {
-                *it = unary_op(*in_it);
-              }
-            }
-            //it = std::transform(firstIt, last.base(), it, unary_op);
-            firstIt += std_dist;
-            first = bit_iterator<RandomAccessItIn>(firstIt);
-            remaining_bits_to_op -= digits * N;
+      for (; firstIt != lastIt; ++firstIt, ++it) {
+        if constexpr (std::is_invocable_v<UnaryOperation, word_type, size_type>) {
+          *it = unary_op(*firstIt, digits);
+        } else {
+          *it = unary_op(*firstIt);
+        }
+      }
     } else {
-      while (remaining_bits_to_op >= digits) {
+      for (size_type i = 0; i < N; ++i, ++it, advance(in, digits)) {
         if constexpr (std::is_invocable_v<UnaryOperation, word_type, size_type>) {
-          *it = unary_op(get_word<word_type>(first, digits), digits);
+          *it = unary_op(get_word<word_type>(in, digits), digits);
         } else {
-          *it = unary_op(get_word<word_type>(first, digits));
+          *it = unary_op(get_word<word_type>(in, digits));
         }
-
-        remaining_bits_to_op -= digits;
-        it++;
-        advance(first, digits);
       }
     }
-        if (remaining_bits_to_op > 0) {
-          word_type result;
-          if constexpr (std::is_invocable_v<UnaryOperation, word_type, size_type>) {
-            result = unary_op(get_masked_word<word_type>(first, remaining_bits_to_op), remaining_bits_to_op);
-          } else {
-            result = unary_op(get_masked_word<word_type>(first, remaining_bits_to_op));
-          }
-          *it = _bitblend(
-              *it,
-              result,
-              _mask<word_type>(remaining_bits_to_op));
-        }
+    seg += N - 1;
   }
-    return d_first + total_bits_to_op;
+  return d_first + total_bits_to_op;
 }
 
 template <class RandomAccessItIn, class RandomAccessItOut, class BinaryOperation>
@@ -171,63 +135,36 @@ constexpr bit_iterator<RandomAccessItOut> transform(
     return d_first;
   }
 
-  // Initialization
-  const bool is_d_first_aligned = d_first.position() == 0;
-  size_type total_bits_to_op = distance(first1, last1);
-  size_type remaining_bits_to_op = total_bits_to_op;
-  auto it = d_first.base();
+  const size_type total_bits_to_op = distance(first1, last1);
+  const auto segments = words(d_first, d_first + total_bits_to_op);
+  for (auto seg = segments.begin(); seg != segments.end(); ++seg) {
+    const auto segment = *seg;
+    auto it = seg.base();
+    auto in1 = first1 + seg.offset();
+    auto in2 = first2 + seg.offset();
+    if (!segment.full()) {
+      const size_type bits = segment.size();
+      const auto shift = static_cast<word_type>(segment.position());
+      *it = _bitblend(
+          *it,
+          binary_op(
+              static_cast<word_type>(get_masked_word<word_type>(in1, bits) << shift),
+              static_cast<word_type>(get_masked_word<word_type>(in2, bits) << shift)),
+          segment.mask);
+      continue;
+    }
 
-  // d_first is not aligned. Copy partial word to align it
-  if (!is_d_first_aligned) {
-    size_type partial_bits_to_op = ::std::min(
-        remaining_bits_to_op,
-        digits - d_first.position());
-    *it = _bitblend(
-        *it,
-        binary_op(
-            static_cast<word_type>(
-                get_masked_word<word_type>(first1, partial_bits_to_op)
-                << static_cast<word_type>(d_first.position())),
-            static_cast<word_type>(
-                get_masked_word<word_type>(first2, partial_bits_to_op)
-                << static_cast<word_type>(d_first.position()))),
-        d_first.position(),
-        partial_bits_to_op);
-    remaining_bits_to_op -= partial_bits_to_op;
-    advance(first1, partial_bits_to_op);
-    advance(first2, partial_bits_to_op);
-    it++;
-  }
-  if (remaining_bits_to_op > 0) {
-    const bool is_first1_aligned = first1.position() == 0;
-    const bool is_first2_aligned = first2.position() == 0;
-    //size_type words_to_op = ::std::ceil(remaining_bits_to_op / static_cast<float>(digits));
-    // d_first will be aligned at this point
-    if (is_first1_aligned && is_first2_aligned && remaining_bits_to_op > digits) {
-      auto N = ::std::distance(first1.base(), last1.base());
-      it = std::transform(first1.base(), last1.base(), first2.base(), it, binary_op);
-      first1 += digits * N;
-      first2 += digits * N;
-      remaining_bits_to_op -= digits * N;
+    const size_type N = (total_bits_to_op - seg.offset()) / digits;
+    if (in1.position() == 0 && in2.position() == 0) {
+      std::transform(in1.base(), in1.base() + N, in2.base(), it, binary_op);
     } else {
-      while (remaining_bits_to_op >= digits) {
+      for (size_type i = 0; i < N; ++i, ++it, advance(in1, digits), advance(in2, digits)) {
         *it = binary_op(
-            get_word<word_type>(first1, digits),
-            get_word<word_type>(first2, digits));
-        remaining_bits_to_op -= digits;
-        it++;
-        advance(first1, digits);
-        advance(first2, digits);
+            get_word<word_type>(in1, digits),
+            get_word<word_type>(in2, digits));
       }
     }
-    if (remaining_bits_to_op > 0) {
-      *it = _bitblend(
-          *it,
-          binary_op(
-              get_masked_word<word_type>(first1, remaining_bits_to_op),
-              get_masked_word<word_type>(first2, remaining_bits_to_op)),
-          _mask<word_type>(remaining_bits_to_op));
-    }
+    seg += N - 1;
   }
   return d_first + total_bits_to_op;
 }
@@ -314,6 +251,52 @@ constexpr bit_iterator<RandomAccessItOut> transform(
 //}
 
 
+// Applies the operation to chunks concurrently. Chunks are aligned to the
+// destination words so that no two workers write to the same word.
+template <_execution_policy ExecutionPolicy, class RandomAccessItIn, class RandomAccessItOut, class UnaryOperation>
+bit_iterator<RandomAccessItOut> transform(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessItIn> first,
+    bit_iterator<RandomAccessItIn> last,
+    bit_iterator<RandomAccessItOut> d_first,
+    UnaryOperation unary_op) {
+  _assert_range_viability(first, last);
+  using word_type = typename bit_iterator<RandomAccessItOut>::word_type;
+  const auto n = distance(first, last);
+
+  const auto chunks = _parallel_chunks<word_type>(n, d_first.position());
+  std::for_each(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      [first, d_first, &unary_op](const auto& chunk) {
+        bit::transform(first + chunk.first, first + chunk.second, d_first + chunk.first, unary_op);
+      });
+  return d_first + n;
+}
+
+template <_execution_policy ExecutionPolicy, class RandomAccessItIn, class RandomAccessItOut, class BinaryOperation>
+bit_iterator<RandomAccessItOut> transform(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessItIn> first1,
+    bit_iterator<RandomAccessItIn> last1,
+    bit_iterator<RandomAccessItIn> first2,
+    bit_iterator<RandomAccessItOut> d_first,
+    BinaryOperation binary_op) {
+  _assert_range_viability(first1, last1);
+  using word_type = typename bit_iterator<RandomAccessItOut>::word_type;
+  const auto n = distance(first1, last1);
+
+  const auto chunks = _parallel_chunks<word_type>(n, d_first.position());
+  std::for_each(
+      std::forward<ExecutionPolicy>(policy),
+      chunks.begin(), chunks.end(),
+      [first1, first2, d_first, &binary_op](const auto& chunk) {
+        bit::transform(first1 + chunk.first, first1 + chunk.second,
+                       first2 + chunk.first, d_first + chunk.first, binary_op);
+      });
+  return d_first + n;
+}
+
 // ========================================================================== //
 } // namespace bit
 
@@ -0,0 +1,135 @@
+// ============================ TRANSFORM COUNT ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        transform_count.hpp
+// Description: Fused binary operation and popcount over two bit ranges
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_TRANSFORM_COUNT_HPP_INCLUDED
+#define _BIT_TRANSFORM_COUNT_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <type_traits>
+
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+
+namespace bit {
+
+/**
+ * @brief Number of ones in binary_op(first1[i], first2[i]) over [first1, last1)
+ *
+ * Both ranges are streamed once, a word at a time, without a temporary.
+ * The first range is word aligned after its leading partial word; a second
+ * range at a different position() is realigned by funnel shifting
+ * neighbouring words.
+ *
+ * @param binary_op Word-wise operation, e.g. std::bit_and<>
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2, typename BinaryOperation>
+  requires std::is_same_v<std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>,
+                          std::remove_cv_t<typename bit_iterator<RandomAccessIt2>::word_type>>
+constexpr typename bit_iterator<RandomAccessIt1>::difference_type transform_count(
+    bit_iterator<RandomAccessIt1> first1,
+    const bit_iterator<RandomAccessIt1>& last1,
+    bit_iterator<RandomAccessIt2> first2,
+    BinaryOperation binary_op) {
+  using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_iterator<RandomAccessIt1>::size_type;
+  using difference_type = typename bit_iterator<RandomAccessIt1>::difference_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  const auto op = [&binary_op](word_type a, word_type b) -> uword_type {
+    return static_cast<uword_type>(binary_op(a, b));
+  };
+
+  size_type remaining = distance(first1, last1);
+  difference_type ones = 0;
+
+  if (first1.position() != 0) {
+    const size_type len = std::min(remaining, digits - first1.position());
+    ones += std::popcount(static_cast<uword_type>(
+        op(get_word<word_type>(first1, len), get_word<word_type>(first2, len)) & _mask<uword_type>(len)));
+    first1 += len;
+    first2 += len;
+    remaining -= len;
+  }
+
+  const size_type words = remaining / digits;
+  RandomAccessIt1 it1 = first1.base();
+  RandomAccessIt2 it2 = first2.base();
+  if (first2.position() == 0) {
+    for (size_type i = 0; i < words; ++i) {
+      ones += std::popcount(op(*it1++, *it2++));
+    }
+  } else {
+    const size_type shift = first2.position();
+    uword_type lo = static_cast<uword_type>(*it2);
+    for (size_type i = 0; i < words; ++i) {
+      const uword_type hi = static_cast<uword_type>(*++it2);
+      const word_type word2 = static_cast<word_type>((lo >> shift) | static_cast<uword_type>(hi << (digits - shift)));
+      ones += std::popcount(op(*it1++, word2));
+      lo = hi;
+    }
+  }
+  first1 += words * digits;
+  first2 += words * digits;
+  remaining -= words * digits;
+
+  if (remaining) {
+    ones += std::popcount(static_cast<uword_type>(
+        op(get_word<word_type>(first1, remaining), get_word<word_type>(first2, remaining)) & _mask<uword_type>(remaining)));
+  }
+  return ones;
+}
+
+/**
+ * @brief Size of the intersection of two bit ranges
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2>
+constexpr typename bit_iterator<RandomAccessIt1>::difference_type count_and(
+    const bit_iterator<RandomAccessIt1>& first1,
+    const bit_iterator<RandomAccessIt1>& last1,
+    const bit_iterator<RandomAccessIt2>& first2) {
+  return transform_count(first1, last1, first2, std::bit_and<>{});
+}
+
+/**
+ * @brief Size of the union of two bit ranges
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2>
+constexpr typename bit_iterator<RandomAccessIt1>::difference_type count_or(
+    const bit_iterator<RandomAccessIt1>& first1,
+    const bit_iterator<RandomAccessIt1>& last1,
+    const bit_iterator<RandomAccessIt2>& first2) {
+  return transform_count(first1, last1, first2, std::bit_or<>{});
+}
+
+/**
+ * @brief Hamming distance between two bit ranges
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2>
+constexpr typename bit_iterator<RandomAccessIt1>::difference_type count_xor(
+    const bit_iterator<RandomAccessIt1>& first1,
+    const bit_iterator<RandomAccessIt1>& last1,
+    const bit_iterator<RandomAccessIt2>& first2) {
+  return transform_count(first1, last1, first2, std::bit_xor<>{});
+}
+
+/**
+ * @brief Number of bits set in the first range but not in the second
+ */
+template <typename RandomAccessIt1, typename RandomAccessIt2>
+constexpr typename bit_iterator<RandomAccessIt1>::difference_type count_andnot(
+    const bit_iterator<RandomAccessIt1>& first1,
+    const bit_iterator<RandomAccessIt1>& last1,
+    const bit_iterator<RandomAccessIt2>& first2) {
+  return transform_count(first1, last1, first2, [](auto a, auto b) { return a & ~b; });
+}
+
+}  // namespace bit
+
+#endif  // _BIT_TRANSFORM_COUNT_HPP_INCLUDED
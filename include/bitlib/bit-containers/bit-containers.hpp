@@ -10,8 +10,17 @@
 #include "bit_array.hpp"
 #include "bit_array_dynamic_extent.hpp"
 #include "bit_array_ref.hpp"
+#include "bit_atomic_array.hpp"
+#include "bit_expression.hpp"
+#include "bit_hierarchical_vector.hpp"
 #include "bit_literal.hpp"
+#include "bit_mapped_vector.hpp"
+#include "bit_matrix.hpp"
 #include "bit_mdspan_accessor.hpp"
+#include "bit_pmr.hpp"
+#include "bit_rank_select.hpp"
+#include "bit_roaring_bitmap.hpp"
+#include "bit_serialize.hpp"
 #include "bit_span.hpp"
 #include "bit_vector.hpp"
 // ========================================================================== //
@@ -13,17 +13,21 @@
 // ================================ PREAMBLE ================================ //
 // C++ standard library
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cmath>
+#include <cstddef>
 #include <span>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 // Project sources
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
 #include "bitlib/bit-containers/bit_array_base.hpp"
 #include "bitlib/bit-containers/bit_bitsof.hpp"
+#include "bitlib/bit-containers/bit_expression.hpp"
 #include "bitlib/bit-containers/bit_policy.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 #include "bitlib/bit_concepts.hpp"
@@ -65,6 +69,7 @@ struct array_iterator_types {
                                                    bit_iterator<typename std::array<word_type, Words<value_type, word_type, N>()>::const_iterator>,
                                                    typename std::array<const word_type, Words<value_type, word_type, N>()>::const_iterator>::type;
 };
+
 }  // namespace detail
 
 template <typename T, std::size_t N, typename W, typename Policy>
@@ -86,6 +91,10 @@ class array : public array_base<array<T, N, W, Policy>, T, N, W, false, Policy,
 
   static constexpr std::size_t bits = N * bitsof<T>();
 
+ private:
+  using kernels = detail::fixed_words<word_type, bits>;
+  static constexpr bool is_bit_array = std::is_same_v<value_type, bit_value>;
+
  protected:
   static constexpr std::size_t Words(std::size_t size_) {
     return (size_ * bitsof<value_type>() + bitsof<word_type>() - 1) / bitsof<word_type>();
@@ -100,7 +109,7 @@ class array : public array_base<array<T, N, W, Policy>, T, N, W, false, Policy,
   */
   constexpr array() noexcept : storage{} {}
 
-  constexpr array(value_type bit_val) {
+  constexpr array(value_type bit_val) : storage{} {
     this->fill(bit_val);
   }
 
@@ -119,23 +128,23 @@ class array : public array_base<array<T, N, W, Policy>, T, N, W, false, Policy,
   constexpr array(const array<T, N, W, Policy>&& other) noexcept
       : base(), storage(other.storage) {}
 
-  constexpr array(const bit_sized_range auto& other) : base() {
+  constexpr array(const bit_sized_range auto& other) : base(), storage{} {
     if (other.size() != this->size()) [[unlikely]] {
       throw std::invalid_argument("other bit_range contains an invalid number of bits for array.");
     }
-    ::bit::copy(other.begin(), other.end(), this->begin());
+    assign_range(other);
   };
 
   constexpr array(const std::initializer_list<value_type> init)
     requires(!std::is_same_v<value_type, word_type>)
-      : base() {
+      : base(), storage{} {
     if (init.size() != bitsof(*this)) [[unlikely]] {
       throw std::invalid_argument("initialize_list contains an invalid number of bits for array.");
     }
     std::copy(init.begin(), init.end(), this->begin());
   }
 
-  constexpr array(const std::initializer_list<bool> init) : base() {
+  constexpr array(const std::initializer_list<bool> init) : base(), storage{} {
     if (init.size() != bitsof(*this)) [[unlikely]] {
       throw std::invalid_argument("initialize_list contains an invalid number of bits for array.");
     }
@@ -152,7 +161,7 @@ class array : public array_base<array<T, N, W, Policy>, T, N, W, false, Policy,
 
   constexpr array(const std::string_view s)
     requires(std::is_same_v<value_type, bit_value>)
-      : base() {
+      : base(), storage{} {
     if (bitsof(*this) != static_cast<size_t>(std::count(s.begin(), s.end(), '0') + std::count(s.begin(), s.end(), '1'))) [[unlikely]] {
       throw std::invalid_argument("String contains an invalid number of bits for array.");
     };
@@ -176,7 +185,7 @@ class array : public array_base<array<T, N, W, Policy>, T, N, W, false, Policy,
     if (other.size() != this->size()) [[unlikely]] {
       throw std::invalid_argument("other bit_sized_range contains an invalid number of bits for array.");
     }
-    ::bit::copy(other.begin(), other.end(), this->begin());
+    assign_range(other);
     return *this;
   };
 
@@ -218,13 +227,138 @@ class array : public array_base<array<T, N, W, Policy>, T, N, W, false, Policy,
     std::swap(this->storage, other.storage);
   }
 
+  constexpr void fill(value_type bit_val) noexcept {
+    if constexpr (is_bit_array) {
+      kernels::fill(storage.data(), bit_val);
+    } else {
+      base::fill(bit_val);
+    }
+  }
+
+  // Same-type operands skip the expression machinery entirely
+  using base::operator&=;
+  using base::operator|=;
+  using base::operator^=;
+  constexpr array& operator&=(const array& other) noexcept
+    requires(is_bit_array)
+  {
+    kernels::apply(storage.data(), other.storage.data(), std::bit_and<>{});
+    return *this;
+  }
+  constexpr array& operator|=(const array& other) noexcept
+    requires(is_bit_array)
+  {
+    kernels::apply(storage.data(), other.storage.data(), std::bit_or<>{});
+    return *this;
+  }
+  constexpr array& operator^=(const array& other) noexcept
+    requires(is_bit_array)
+  {
+    kernels::apply(storage.data(), other.storage.data(), std::bit_xor<>{});
+    return *this;
+  }
+
+  // Whole-word kernels in place of the range shifts; see array_base
+  using base::operator<<;
+  using base::operator>>;
+  constexpr array& operator<<=(size_type n) noexcept
+    requires(is_bit_array)
+  {
+    kernels::shift_right(storage.data(), n);
+    return *this;
+  }
+  constexpr array& operator>>=(size_type n) noexcept
+    requires(is_bit_array)
+  {
+    kernels::shift_left(storage.data(), n);
+    return *this;
+  }
+
+  // Inverts every bit in place
+  constexpr array& flip() noexcept
+    requires(is_bit_array)
+  {
+    kernels::invert(storage.data());
+    return *this;
+  }
+
   constexpr operator bit_value() const noexcept
     requires(std::is_same_v<value_type, bit_value> && N == 1)
   {
     return this->begin()[0];
   }
+
+ private:
+  constexpr void assign_range(const bit_sized_range auto& other) {
+    using range_type = std::remove_cvref_t<decltype(other)>;
+    if constexpr (is_bit_array && detail::bit_expression_c<range_type>) {
+      static_assert(std::is_same_v<typename range_type::word_type, word_type>,
+                    "bit expression operands must share the array word type");
+      kernels::assign(storage.data(), other);
+    } else {
+      ::bit::copy(other.begin(), other.end(), this->begin());
+    }
+  }
 };
 
+/*
+* Whole-array algorithms for fixed extents, on the straight-line kernels
+*/
+template <std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr std::ptrdiff_t count(const array<bit_value, N, W, Policy>& a, bit_value value) noexcept {
+  const auto ones = static_cast<std::ptrdiff_t>(detail::fixed_words<W, N>::count(a.data()));
+  return value == bit1 ? ones : static_cast<std::ptrdiff_t>(N) - ones;
+}
+
+template <std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr auto find(const array<bit_value, N, W, Policy>& a, bit_value value) noexcept {
+  return a.begin() + detail::fixed_words<W, N>::find(a.data(), value);
+}
+
+template <std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr auto find(array<bit_value, N, W, Policy>& a, bit_value value) noexcept {
+  return a.begin() + detail::fixed_words<W, N>::find(a.data(), value);
+}
+
+// Bits vacated by a whole-array shift are cleared
+template <std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr auto shift_left(array<bit_value, N, W, Policy>& a, std::ptrdiff_t n) noexcept {
+  if (n <= 0) {
+    return a.end();
+  }
+  detail::fixed_words<W, N>::shift_left(a.data(), static_cast<std::size_t>(n));
+  return a.begin() + (N - std::min<std::size_t>(n, N));
+}
+
+template <std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr auto shift_right(array<bit_value, N, W, Policy>& a, std::ptrdiff_t n) noexcept {
+  if (n <= 0) {
+    return a.begin();
+  }
+  detail::fixed_words<W, N>::shift_right(a.data(), static_cast<std::size_t>(n));
+  return a.begin() + std::min<std::size_t>(n, N);
+}
+
+// Shifts by a compile-time amount
+template <std::size_t n, std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr auto shift_left(array<bit_value, N, W, Policy>& a) noexcept {
+  detail::fixed_words<W, N>::shift_left(a.data(), std::integral_constant<std::size_t, n>{});
+  return a.begin() + (N - std::min(n, N));
+}
+
+template <std::size_t n, std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+constexpr auto shift_right(array<bit_value, N, W, Policy>& a) noexcept {
+  detail::fixed_words<W, N>::shift_right(a.data(), std::integral_constant<std::size_t, n>{});
+  return a.begin() + std::min(n, N);
+}
+
 static_assert(bit_range<bit_array<11>>, "array does not satisfy bit_range concept!");
 static_assert(bit_sized_range<bit_array<11>>, "array does not satisfy bit_sized_range concept!");
 #ifdef CONTIGUOUS_RANGE
@@ -15,14 +15,17 @@
 #include <algorithm>
 #include <bit>
 #include <cmath>
+#include <cstddef>
 #include <span>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 // Project sources
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
 #include "bitlib/bit-containers/bit_bitsof.hpp"
+#include "bitlib/bit-containers/bit_expression.hpp"
 #include "bitlib/bit-containers/bit_policy.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 
@@ -37,6 +40,214 @@ template <typename T,
           typename Policy>
 class array;
 
+namespace detail {
+
+template <typename T>
+struct is_fixed_bit_array : std::false_type {};
+
+template <std::size_t N, typename W, typename Policy>
+  requires(N != std::dynamic_extent)
+struct is_fixed_bit_array<array<bit_value, N, W, Policy>> : std::true_type {};
+
+/**
+ * @brief Straight-line kernels over the storage of a fixed-extent bit array
+ *
+ * Up to 512 bits the word count and the mask of the valid bits in the last
+ * word are compile-time constants, so every operation is a fold over an
+ * index_sequence and compiles to a fixed run of word (or vector) operations
+ * with no head or tail handling. Larger arrays run the bit:: range
+ * algorithms instead, so code size and compile time do not grow with Bits.
+ * The padding bits above Bits in the last word are never written and are
+ * masked off wherever they could be seen.
+ */
+template <typename W, std::size_t Bits>
+struct fixed_words {
+  using uword_type = std::make_unsigned_t<W>;
+  static constexpr std::size_t digits = bitsof<W>();
+  static constexpr std::size_t words = (Bits + digits - 1) / digits;
+  static constexpr std::size_t tail = Bits % digits;
+  static constexpr uword_type last_mask = _mask<uword_type, _mask_len::unknown>(tail ? tail : digits);
+  static constexpr bool unrolled = words <= 512 / digits;
+
+  template <typename F>
+  static constexpr void unroll(F&& f) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (f(I), ...);
+    }(std::make_index_sequence<words>{});
+  }
+
+  // Visits the words from the last down to the first
+  template <typename F>
+  static constexpr void unroll_down(F&& f) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (f(words - 1 - I), ...);
+    }(std::make_index_sequence<words>{});
+  }
+
+  // Stops at the first i for which f returns true
+  template <typename F>
+  static constexpr void unroll_until(F&& f) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      (f(I) || ...);
+    }(std::make_index_sequence<words>{});
+  }
+
+  static constexpr bit_iterator<W*> bits(W* w) {
+    return bit_iterator<W*>(w);
+  }
+
+  static constexpr bit_iterator<const W*> bits(const W* w) {
+    return bit_iterator<const W*>(w);
+  }
+
+  // Word i with the padding bits cleared
+  static constexpr uword_type load(const W* w, std::size_t i) {
+    const uword_type word = static_cast<uword_type>(w[i]);
+    return (tail && i + 1 == words) ? static_cast<uword_type>(word & last_mask) : word;
+  }
+
+  // Writes word i, leaving the padding bits as they were
+  static constexpr void store(W* w, std::size_t i, uword_type word) {
+    if (tail && i + 1 == words) {
+      word = static_cast<uword_type>((static_cast<uword_type>(w[i]) & ~last_mask) | (word & last_mask));
+    }
+    w[i] = static_cast<W>(word);
+  }
+
+  static constexpr bool equal(const W* lhs, const W* rhs) {
+    if constexpr (unrolled) {
+      uword_type diff = 0;
+      unroll([&](std::size_t i) { diff |= static_cast<uword_type>(load(lhs, i) ^ load(rhs, i)); });
+      return diff == 0;
+    } else {
+      return ::bit::equal(bits(lhs), bits(lhs) + Bits, bits(rhs));
+    }
+  }
+
+  static constexpr std::size_t count(const W* w) {
+    if constexpr (unrolled) {
+      std::size_t ones = 0;
+      unroll([&](std::size_t i) { ones += std::popcount(load(w, i)); });
+      return ones;
+    } else {
+      return static_cast<std::size_t>(::bit::count(bits(w), bits(w) + Bits, bit1));
+    }
+  }
+
+  // Index of the first bit equal to value, or Bits if there is none
+  static constexpr std::size_t find(const W* w, bit_value value) {
+    if constexpr (unrolled) {
+      const uword_type flip = value == bit1 ? uword_type(0) : static_cast<uword_type>(-1);
+      std::size_t pos = Bits;
+      unroll_until([&](std::size_t i) {
+        const uword_type word = static_cast<uword_type>(load(w, i) ^ ((tail && i + 1 == words) ? static_cast<uword_type>(flip & last_mask) : flip));
+        if (word) {
+          pos = i * digits + std::countr_zero(word);
+        }
+        return word != 0;
+      });
+      return pos;
+    } else {
+      return static_cast<std::size_t>(::bit::find(bits(w), bits(w) + Bits, value) - bits(w));
+    }
+  }
+
+  static constexpr void fill(W* w, bit_value value) {
+    if constexpr (unrolled) {
+      const uword_type word = value == bit1 ? static_cast<uword_type>(-1) : uword_type(0);
+      unroll([&](std::size_t i) { store(w, i, word); });
+    } else {
+      ::bit::fill(bits(w), bits(w) + Bits, value);
+    }
+  }
+
+  static constexpr void invert(W* w) {
+    if constexpr (unrolled) {
+      unroll([&](std::size_t i) { store(w, i, static_cast<uword_type>(~static_cast<uword_type>(w[i]))); });
+    } else {
+      const W* const src = w;
+      ::bit::transform(bits(src), bits(src) + Bits, bits(w), [](W word) -> W { return static_cast<W>(~word); });
+    }
+  }
+
+  // dst = op(dst, src) word by word
+  template <typename Op>
+  static constexpr void apply(W* dst, const W* src, Op op) {
+    if constexpr (unrolled) {
+      unroll([&](std::size_t i) {
+        store(dst, i, static_cast<uword_type>(op(static_cast<uword_type>(dst[i]), static_cast<uword_type>(src[i]))));
+      });
+    } else {
+      const W* const lhs = dst;
+      ::bit::transform(bits(lhs), bits(lhs) + Bits, bits(src), bits(dst), [op](W a, W b) -> W {
+        return static_cast<W>(op(static_cast<uword_type>(a), static_cast<uword_type>(b)));
+      });
+    }
+  }
+
+  // Evaluates a bit expression of Bits bits into w
+  template <typename Expression>
+  static constexpr void assign(W* w, const Expression& expression) {
+    if constexpr (unrolled) {
+      unroll([&](std::size_t i) {
+        const std::size_t pos = i * digits;
+        store(w, i, static_cast<uword_type>(expression.aligned(pos) ? expression.aligned_word(pos) : expression.word(pos, std::min(digits, Bits - pos))));
+      });
+    } else {
+      ::bit::copy(expression.begin(), expression.end(), bits(w));
+    }
+  }
+
+  // Moves every bit n places towards index 0 (the bit::shift_left
+  // direction) and clears the n bits vacated at the end. n may be a
+  // std::integral_constant, making the word and bit offsets constants too.
+  template <typename Amount>
+  static constexpr void shift_left(W* w, Amount n) {
+    if (n >= Bits) {
+      fill(w, bit0);
+      return;
+    }
+    if constexpr (unrolled) {
+      // Word i only reads words i + q and up, which are not yet written
+      const std::size_t q = n / digits;
+      const std::size_t r = n % digits;
+      unroll([&](std::size_t i) {
+        const uword_type lo = i + q < words ? load(w, i + q) : uword_type(0);
+        const uword_type hi = i + q + 1 < words ? load(w, i + q + 1) : uword_type(0);
+        store(w, i, r ? static_cast<uword_type>(lsr(lo, r) | static_cast<uword_type>(hi << (digits - r))) : lo);
+      });
+    } else {
+      const std::size_t amount = n;
+      ::bit::fill(::bit::shift_left(bits(w), bits(w) + Bits, static_cast<std::ptrdiff_t>(amount)), bits(w) + Bits, bit0);
+    }
+  }
+
+  // Moves every bit n places away from index 0 (the bit::shift_right
+  // direction) and clears the n bits vacated at the start
+  template <typename Amount>
+  static constexpr void shift_right(W* w, Amount n) {
+    if (n >= Bits) {
+      fill(w, bit0);
+      return;
+    }
+    if constexpr (unrolled) {
+      // Word i only reads words i - q and below, which are not yet written
+      const std::size_t q = n / digits;
+      const std::size_t r = n % digits;
+      unroll_down([&](std::size_t i) {
+        const uword_type hi = i >= q ? load(w, i - q) : uword_type(0);
+        const uword_type lo = i >= q + 1 ? load(w, i - q - 1) : uword_type(0);
+        store(w, i, r ? static_cast<uword_type>(static_cast<uword_type>(hi << r) | lsr(lo, digits - r)) : hi);
+      });
+    } else {
+      const std::size_t amount = n;
+      ::bit::fill(bits(w), ::bit::shift_right(bits(w), bits(w) + Bits, static_cast<std::ptrdiff_t>(amount)), bit0);
+    }
+  }
+};
+
+}  // namespace detail
+
 /**
  * @brief Base class template for array implementations
  *
@@ -215,54 +426,59 @@ class array_base : public detail::container_size_storage<std::size_t, resizable,
     return integral;
   }
 
-  using compatible_bitarray = array<value_type, N, word_type, Policy>;
-
-  constexpr compatible_bitarray operator~() {
-    compatible_bitarray result(detail::uninitialized, size());
-    transform(derived().begin(), derived().end(), result.begin(), [](const word_type& bits) -> word_type { return ~bits; });
-    return result;
-  }
+  using compatible_bitarray = array<value_type, N, std::remove_cv_t<word_type>, Policy>;
 
-  constexpr compatible_bitarray operator|(const bit_sized_range auto& other) const {
-    assert(other.size() == size());
-    compatible_bitarray result(detail::uninitialized, size());
-    transform(derived().begin(), derived().end(), other.begin(), result.begin(),
-              [](const word_type& a, const word_type& b) -> word_type { return a | b; });
-    return result;
-  }
+  // ~, &, | and ^ are the free operators of bit_expression.hpp
   constexpr Derived& operator|=(const bit_sized_range auto& other) {
     assert(other.size() == size());
-    transform(derived().cbegin(), derived().cend(), other.begin(), derived().begin(),
-              [](const word_type& a, const word_type& b) -> word_type { return a | b; });
+    const auto expression = make_bit_expression(std::bit_or<>{}, derived(), other);
+    ::bit::copy(expression.begin(), expression.end(), derived().begin());
     return derived();
   }
-  constexpr compatible_bitarray operator&(const bit_sized_range auto& other) const {
-    assert(other.size() == size());
-    compatible_bitarray result(detail::uninitialized, size());
-    transform(derived().begin(), derived().end(), other.begin(), result.begin(),
-              [](const word_type& a, const word_type& b) -> word_type { return a & b; });
-    return result;
-  }
   constexpr Derived& operator&=(const bit_sized_range auto& other) {
     assert(other.size() == size());
-    transform(derived().cbegin(), derived().cend(), other.begin(), derived().begin(),
-              [](const word_type& a, const word_type& b) -> word_type { return a & b; });
+    const auto expression = make_bit_expression(std::bit_and<>{}, derived(), other);
+    ::bit::copy(expression.begin(), expression.end(), derived().begin());
     return derived();
   }
-  constexpr compatible_bitarray operator^(const bit_sized_range auto& other) const {
-    assert(other.size() == size());
-    compatible_bitarray result(detail::uninitialized, size());
-    transform(derived().begin(), derived().end(), other.begin(), result.begin(),
-              [](const word_type& a, const word_type& b) -> word_type { return a ^ b; });
-    return result;
-  }
   constexpr Derived& operator^=(const bit_sized_range auto& other) {
     assert(other.size() == size());
-    transform(derived().cbegin(), derived().cend(), other.begin(), derived().begin(),
-              [](const word_type& a, const word_type& b) -> word_type { return a ^ b; });
+    const auto expression = make_bit_expression(std::bit_xor<>{}, derived(), other);
+    ::bit::copy(expression.begin(), expression.end(), derived().begin());
     return derived();
   }
 
+  // Shifts as on the integral value: << moves bit i to i + n (the
+  // bit::shift_right direction), >> moves it to i - n. Vacated bits are bit0.
+  constexpr Derived& operator<<=(size_type n)
+    requires(std::is_same_v<T, bit_value>)
+  {
+    const auto first = derived().begin();
+    ::bit::fill(first, ::bit::shift_right(first, derived().end(), static_cast<difference_type>(std::min(n, size()))), bit0);
+    return derived();
+  }
+  constexpr Derived& operator>>=(size_type n)
+    requires(std::is_same_v<T, bit_value>)
+  {
+    const auto last = derived().end();
+    ::bit::fill(::bit::shift_left(derived().begin(), last, static_cast<difference_type>(std::min(n, size()))), last, bit0);
+    return derived();
+  }
+  constexpr compatible_bitarray operator<<(size_type n) const
+    requires(std::is_same_v<T, bit_value>)
+  {
+    compatible_bitarray shifted(derived());
+    shifted <<= n;
+    return shifted;
+  }
+  constexpr compatible_bitarray operator>>(size_type n) const
+    requires(std::is_same_v<T, bit_value>)
+  {
+    compatible_bitarray shifted(derived());
+    shifted >>= n;
+    return shifted;
+  }
+
   friend std::ostream& operator<<(std::ostream& os, const array_base& cv) {
     // Save stream formatting settings
     std::ios_base::fmtflags flags = os.flags();
@@ -335,6 +551,11 @@ class array_base : public detail::container_size_storage<std::size_t, resizable,
 };
 
 constexpr bool operator==(const bit_sized_range auto& lhs, const bit_sized_range auto& rhs) {
+  using range_type = std::remove_cvref_t<decltype(lhs)>;
+  if constexpr (std::is_same_v<range_type, std::remove_cvref_t<decltype(rhs)>> &&
+                detail::is_fixed_bit_array<range_type>::value) {
+    return detail::fixed_words<typename range_type::word_type, range_type::bits>::equal(lhs.data(), rhs.data());
+  }
   if (lhs.size() != rhs.size()) {
     return false;
   }
@@ -16,6 +16,7 @@
 #include <new>
 #include <span>  // std::dynamic_extent
 #include <stdexcept>
+#include <utility>
 
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
 #include "bitlib/bit-containers/bit_array.hpp"
@@ -95,10 +96,9 @@ class array<T, std::dynamic_extent, W, Policy>
       }
     }
 
-    Storage(size_type words, Storage&& other) {
+    Storage(size_type words, Storage&& other) : m_allocator(std::move(other.m_allocator)) {
       if (words > FixedWords) {
-        new (&pointer) word_type_ptr(std::move(other.pointer));
-        other.pointer = nullptr;  // Prevent double deletion
+        new (&pointer) word_type_ptr(std::exchange(other.pointer, nullptr));
       } else {
         for (size_type i = 0; i < words; ++i) {
           new (&fixed[i]) word_type(std::move(other.fixed[i]));
@@ -106,20 +106,36 @@ class array<T, std::dynamic_extent, W, Policy>
       }
     }
 
-    Storage(size_type words, const Storage& other, const Allocator& allocator = Allocator())
+    // Steals the buffer only when it can be released through allocator
+    Storage(size_type words, Storage&& other, const Allocator& allocator) : m_allocator(allocator) {
+      if (words > FixedWords && m_allocator == other.m_allocator) {
+        new (&pointer) word_type_ptr(std::exchange(other.pointer, nullptr));
+      } else if (words > FixedWords) {
+        new (&pointer) word_type_ptr(m_allocator.allocate(words));
+        std::uninitialized_copy_n(other.pointer, words, pointer);
+      } else {
+        for (size_type i = 0; i < words; ++i) {
+          new (&fixed[i]) word_type(std::move(other.fixed[i]));
+        }
+      }
+    }
+
+    Storage(size_type words, const Storage& other, const Allocator& allocator)
         : m_allocator(allocator) {
       if (words > FixedWords) {
         new (&pointer) word_type_ptr(m_allocator.allocate(words));
-        for (size_t i = 0; i < words; ++i) {
-          new (pointer + i) word_type(other.pointer[i]);
-        }
-        std::copy_n(other.pointer, words, pointer);
+        std::uninitialized_copy_n(other.pointer, words, pointer);
       } else {
         for (size_type i = 0; i < words; ++i) {
           new (&fixed[i]) word_type(other.fixed[i]);
         }
       }
     }
+
+    Storage(size_type words, const Storage& other)
+        : Storage(words, other, std::allocator_traits<Allocator>::select_on_container_copy_construction(other.m_allocator)) {
+    }
+
     template <typename U>
     Storage(size_type words, const U& val, const Allocator& allocator = Allocator())
         : m_allocator(allocator) {
@@ -145,7 +161,9 @@ class array<T, std::dynamic_extent, W, Policy>
  public:
   ~array() {
     if (size() > FixedBits) {
-      storage.m_allocator.deallocate(storage.pointer, Words(size()));
+      if (storage.pointer) {
+        storage.m_allocator.deallocate(storage.pointer, Words(size()));
+      }
     } else if constexpr (!std::is_fundamental_v<T>) {
       for (size_type i = 0; i < Words(size()); ++i) {
         // W is 'word_type', but MSVC is unhappy with using an alias
@@ -265,8 +283,15 @@ class array<T, std::dynamic_extent, W, Policy>
     if (nullptr == data() || size() != other.size()) {
       throw std::invalid_argument("Cannot reassign array<std::dynamic_extent,V,W,Policy> extent");
     }
-    array<T, std::dynamic_extent, W, Policy> temp(std::move(other));
-    swap(temp);
+    if (this == &other) [[unlikely]] {
+      return *this;
+    }
+    if (size() > FixedBits && storage.m_allocator != other.storage.m_allocator) {
+      // The buffer cannot change hands between unequal allocators
+      std::copy_n(other.storage.pointer, Words(size()), storage.pointer);
+    } else {
+      swap(other);
+    }
     return *this;
   }
 
@@ -314,6 +339,11 @@ class array<T, std::dynamic_extent, W, Policy>
   constexpr void swap(array<T, std::dynamic_extent, W, Policy>& other) noexcept {
     assert(size() == other.size());
     if (size() > FixedBits) {
+      if constexpr (std::allocator_traits<Allocator>::propagate_on_container_swap::value) {
+        std::swap(this->storage.m_allocator, other.storage.m_allocator);
+      } else {
+        assert(this->storage.m_allocator == other.storage.m_allocator);
+      }
       std::swap(this->storage.pointer, other.storage.pointer);
     } else {
       for (size_type i = 0; i < Words(size()); ++i) {
@@ -0,0 +1,234 @@
+// ============================ ATOMIC BIT ARRAY ============================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_atomic_array.hpp
+// Description: Fixed size bit array safe for concurrent access
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_ATOMIC_ARRAY_HPP_INCLUDED
+#define _BIT_ATOMIC_ARRAY_HPP_INCLUDED
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "bitlib/bit-iterator/bit.hpp"
+
+namespace bit {
+
+/**
+ * @brief Reference to a single bit of an atomic_bit_array
+ *
+ * Every operation is a single atomic operation on the containing word, so
+ * concurrent writers to other bits of the same word are never lost.
+ */
+template <std::integral W>
+class atomic_bit_reference {
+ public:
+  using word_type = W;
+
+ private:
+  using uword_type = std::make_unsigned_t<W>;
+
+  W* word_;
+  W mask_;
+
+  std::atomic_ref<W> atomic() const noexcept {
+    return std::atomic_ref<W>(*word_);
+  }
+
+  constexpr bit_value test(W word) const noexcept {
+    return (word & mask_) ? bit1 : bit0;
+  }
+
+ public:
+  constexpr atomic_bit_reference(W* word, std::size_t position) noexcept
+      : word_(word), mask_(static_cast<W>(uword_type{1} << position)) {}
+
+  atomic_bit_reference(const atomic_bit_reference&) = default;
+  atomic_bit_reference& operator=(const atomic_bit_reference&) = delete;
+
+  bit_value load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return test(atomic().load(order));
+  }
+
+  operator bit_value() const noexcept {
+    return load();
+  }
+
+  void store(bit_value value, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    if (value == bit1) {
+      atomic().fetch_or(mask_, order);
+    } else {
+      atomic().fetch_and(static_cast<W>(~mask_), order);
+    }
+  }
+
+  const atomic_bit_reference& operator=(bit_value value) const noexcept {
+    store(value);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the bit, returning its previous value
+   */
+  bit_value test_and_set(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return test(atomic().fetch_or(mask_, order));
+  }
+
+  /**
+   * @brief Clears the bit, returning its previous value
+   */
+  bit_value test_and_reset(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return test(atomic().fetch_and(static_cast<W>(~mask_), order));
+  }
+
+  // The identity operands still perform a read-modify-write, so every
+  // memory order valid for an RMW keeps its meaning
+  bit_value fetch_or(bit_value value, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return test(atomic().fetch_or((value == bit1) ? mask_ : W{0}, order));
+  }
+
+  bit_value fetch_and(bit_value value, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return test(atomic().fetch_and((value == bit0) ? static_cast<W>(~mask_) : static_cast<W>(~W{0}), order));
+  }
+
+  bit_value fetch_xor(bit_value value, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return test(atomic().fetch_xor((value == bit1) ? mask_ : W{0}, order));
+  }
+
+  /**
+   * @brief Inverts the bit, returning its previous value
+   */
+  bit_value flip(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return fetch_xor(bit1, order);
+  }
+};
+
+/**
+ * @brief A fixed size array of bits which may be read and written by many
+ *        threads at once
+ *
+ * The words are only ever accessed through std::atomic_ref, so single bit
+ * operations and the bulk fill, count and find may run alongside concurrent
+ * writers. The bulk operations are atomic per word, not as a whole: a count
+ * taken while other threads write reflects each word at some point during
+ * the call.
+ *
+ * @tparam W The word type of the storage. Must be lock-free for atomic_ref.
+ */
+template <std::integral W = std::uintptr_t>
+class atomic_bit_array {
+ public:
+  using word_type = W;
+  using value_type = bit_value;
+  using size_type = std::size_t;
+  using reference = atomic_bit_reference<W>;
+
+ private:
+  using uword_type = std::make_unsigned_t<W>;
+  static constexpr size_type digits = binary_digits<W>::value;
+  static_assert(std::atomic_ref<W>::is_always_lock_free, "atomic_bit_array requires a lock-free word type");
+
+  std::vector<W> words_;
+  size_type size_ = 0;
+
+  std::atomic_ref<W> word(size_type i) const noexcept {
+    return std::atomic_ref<W>(const_cast<W&>(words_[i]));
+  }
+
+  // Bits of word i that lie inside the array
+  constexpr uword_type valid_mask(size_type i) const noexcept {
+    const size_type len = size_ - i * digits;
+    return (len >= digits) ? static_cast<uword_type>(~uword_type{0}) : _mask<uword_type>(len);
+  }
+
+ public:
+  atomic_bit_array() = default;
+
+  explicit atomic_bit_array(size_type size, bit_value value = bit0)
+      : words_((size + digits - 1) / digits, (value == bit1) ? static_cast<W>(~W{0}) : W{0}), size_(size) {
+  }
+
+  // Copying cannot be made consistent with concurrent writers
+  atomic_bit_array(const atomic_bit_array&) = delete;
+  atomic_bit_array& operator=(const atomic_bit_array&) = delete;
+  atomic_bit_array(atomic_bit_array&&) noexcept = default;
+  atomic_bit_array& operator=(atomic_bit_array&&) noexcept = default;
+
+  size_type size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return 0 == size_;
+  }
+
+  reference operator[](size_type pos) noexcept {
+    assert(pos < size_);
+    return reference(&words_[pos / digits], pos % digits);
+  }
+
+  bit_value operator[](size_type pos) const noexcept {
+    return load(pos);
+  }
+
+  bit_value load(size_type pos, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    assert(pos < size_);
+    return (word(pos / digits).load(order) & (uword_type{1} << (pos % digits))) ? bit1 : bit0;
+  }
+
+  /**
+   * @brief Atomically loads the i-th storage word
+   */
+  W load_word(size_type i, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return word(i).load(order);
+  }
+
+  /**
+   * @brief Sets every bit to value, one atomic store per word
+   */
+  void fill(bit_value value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    const W fill_word = (value == bit1) ? static_cast<W>(~W{0}) : W{0};
+    for (size_type i = 0; i < words_.size(); ++i) {
+      word(i).store(fill_word, order);
+    }
+  }
+
+  /**
+   * @brief Number of bits equal to value, one atomic load per word
+   */
+  size_type count(bit_value value = bit1, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    size_type ones = 0;
+    for (size_type i = 0; i < words_.size(); ++i) {
+      ones += std::popcount(static_cast<uword_type>(static_cast<uword_type>(word(i).load(order)) & valid_mask(i)));
+    }
+    return (value == bit1) ? ones : size_ - ones;
+  }
+
+  /**
+   * @brief Position of the first bit equal to value, or size() if none
+   */
+  size_type find(bit_value value = bit1, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    for (size_type i = 0; i < words_.size(); ++i) {
+      uword_type bits = static_cast<uword_type>(word(i).load(order));
+      if (value == bit0) {
+        bits = static_cast<uword_type>(~bits);
+      }
+      bits &= valid_mask(i);
+      if (bits) {
+        return i * digits + std::countr_zero(bits);
+      }
+    }
+    return size_;
+  }
+};
+
+}  // namespace bit
+
+#endif  // _BIT_ATOMIC_ARRAY_HPP_INCLUDED
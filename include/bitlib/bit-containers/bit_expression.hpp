@@ -0,0 +1,556 @@
+// ============================= BIT_EXPRESSION ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_expression.hpp
+// Description: Lazy bitwise expressions over bit ranges
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_EXPRESSION_HPP_INCLUDED
+#define _BIT_EXPRESSION_HPP_INCLUDED
+
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+template <typename Op, typename... Operands>
+class bit_expression;
+
+template <typename Expression>
+class bit_expression_iterator;
+
+namespace detail {
+
+template <typename T>
+struct is_bit_expression : std::false_type {};
+
+template <typename Op, typename... Operands>
+struct is_bit_expression<bit_expression<Op, Operands...>> : std::true_type {};
+
+template <typename T>
+concept bit_expression_c = is_bit_expression<std::remove_cvref_t<T>>::value;
+
+template <typename T>
+struct is_bit_iterator : std::false_type {};
+
+template <typename Iterator>
+struct is_bit_iterator<bit_iterator<Iterator>> : std::true_type {};
+
+// Ranges whose bits can be read a word at a time
+template <typename R>
+concept bit_word_range = bit_sized_range<R> && requires(const R& r) {
+  requires is_bit_iterator<std::remove_cvref_t<decltype(r.begin())>>::value;
+};
+
+template <typename T>
+concept bit_expression_operand = bit_expression_c<T> || bit_word_range<std::remove_cvref_t<T>>;
+
+// Named ranges are held by reference, sub-expressions and temporaries by value
+template <typename T>
+using bit_expression_storage_t = std::conditional_t<
+    !bit_expression_c<T> && std::is_lvalue_reference_v<T>,
+    const std::remove_reference_t<T>&,
+    std::remove_cvref_t<T>>;
+
+template <typename T>
+struct bit_expression_word {
+  using type = std::remove_cv_t<typename std::remove_cvref_t<decltype(std::declval<const T&>().begin())>::word_type>;
+};
+
+template <typename Op, typename... Operands>
+struct bit_expression_word<bit_expression<Op, Operands...>> {
+  using type = typename bit_expression<Op, Operands...>::word_type;
+};
+
+template <typename T>
+using bit_expression_word_t = typename bit_expression_word<std::remove_cvref_t<T>>::type;
+
+template <typename T>
+struct is_bit_expression_iterator : std::false_type {};
+
+template <typename Expression>
+struct is_bit_expression_iterator<bit_expression_iterator<Expression>> : std::true_type {};
+
+template <typename It>
+concept bit_expression_iterator_c = is_bit_expression_iterator<It>::value;
+
+}  // namespace detail
+
+/**
+ * @brief A lazily evaluated bitwise combination of equally sized bit ranges
+ *
+ * Returned by bit::lazy and by ~, &, | and ^ once an operand is lazy. No
+ * bits are computed until the expression is copied into a container (or
+ * array_ref) or reduced with count, find or equal, and then every operand
+ * is read once, a word at a time, in a single pass.
+ *
+ * Operands that are named ranges are referenced, not copied, so an
+ * expression must not outlive them, and they must not change before it is
+ * evaluated.
+ *
+ * @tparam Op The word-wise operation (std::bit_not, std::bit_and, ...)
+ * @tparam Operands Storage types of the operands
+ */
+template <typename Op, typename... Operands>
+class bit_expression {
+ public:
+  using word_type = detail::bit_expression_word_t<std::tuple_element_t<0, std::tuple<Operands...>>>;
+  using value_type = bit_value;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = bit_expression_iterator<bit_expression>;
+  using const_iterator = iterator;
+
+  static_assert((std::is_same_v<word_type, detail::bit_expression_word_t<Operands>> && ...),
+                "bit expression operands must share a word type");
+
+ private:
+  static constexpr size_type digits = bitsof<word_type>();
+
+  Op op_;
+  std::tuple<Operands...> operands_;
+
+  template <typename Operand>
+  static constexpr word_type operand_word(const Operand& operand, size_type pos, size_type len) {
+    if constexpr (detail::bit_expression_c<Operand>) {
+      return operand.word(pos, len);
+    } else {
+      return get_word<word_type>(operand.begin() + pos, len);
+    }
+  }
+
+  template <typename Operand>
+  static constexpr bool operand_aligned(const Operand& operand, size_type pos) {
+    if constexpr (detail::bit_expression_c<Operand>) {
+      return operand.aligned(pos);
+    } else {
+      return (operand.begin().position() + pos) % digits == 0;
+    }
+  }
+
+  template <typename Operand>
+  static constexpr word_type operand_aligned_word(const Operand& operand, size_type pos) {
+    if constexpr (detail::bit_expression_c<Operand>) {
+      return operand.aligned_word(pos);
+    } else {
+      const auto first = operand.begin();
+      return *std::next(first.base(), (first.position() + pos) / digits);
+    }
+  }
+
+ public:
+  template <typename... Args>
+  constexpr explicit bit_expression(Op op, Args&&... args)
+      : op_(op), operands_(std::forward<Args>(args)...) {
+    assert(((std::get<0>(operands_).size() == args.size()) && ...));
+  }
+
+  constexpr size_type size() const noexcept {
+    return std::get<0>(operands_).size();
+  }
+
+  constexpr bool empty() const noexcept {
+    return 0 == size();
+  }
+
+  constexpr iterator begin() const noexcept {
+    return iterator(this, 0);
+  }
+
+  constexpr iterator end() const noexcept {
+    return iterator(this, size());
+  }
+
+  /**
+   * @brief The len (<= word digits) bits starting at pos, in the low bits.
+   *        Bits above len are unspecified.
+   */
+  constexpr word_type word(size_type pos, size_type len = digits) const {
+    return std::apply([&](const auto&... operand) {
+      return static_cast<word_type>(op_(operand_word(operand, pos, len)...));
+    }, operands_);
+  }
+
+  /**
+   * @brief Whether bit pos of every operand is the first bit of a word
+   */
+  constexpr bool aligned(size_type pos) const {
+    return std::apply([&](const auto&... operand) {
+      return (operand_aligned(operand, pos) && ...);
+    }, operands_);
+  }
+
+  /**
+   * @brief The word starting at pos, when aligned(pos)
+   */
+  constexpr word_type aligned_word(size_type pos) const {
+    return std::apply([&](const auto&... operand) {
+      return static_cast<word_type>(op_(operand_aligned_word(operand, pos)...));
+    }, operands_);
+  }
+};
+
+template <typename Op, detail::bit_expression_operand... Ranges>
+constexpr auto make_bit_expression(Op op, Ranges&&... ranges) {
+  return bit_expression<Op, detail::bit_expression_storage_t<Ranges&&>...>(op, std::forward<Ranges>(ranges)...);
+}
+
+/**
+ * @brief Opts a range into lazy evaluation
+ *
+ * ~, &, | and ^ on plain ranges evaluate at once into a new container.
+ * Once an operand is lazy, every operator built on it yields a
+ * bit_expression instead, so `(bit::lazy(a) & b) | ~bit::lazy(c)` is
+ * computed in one pass when it is assigned or reduced. The expression
+ * references a, b and c.
+ */
+template <detail::bit_expression_operand Range>
+  requires(!detail::bit_expression_c<Range>)
+constexpr auto lazy(Range&& range) {
+  return make_bit_expression(std::identity{}, std::forward<Range>(range));
+}
+
+namespace detail {
+
+// The container a plain range evaluates ~, &, | and ^ into
+template <typename R>
+struct bit_expression_result {};
+
+template <typename R>
+  requires requires { typename R::compatible_bitarray; }
+struct bit_expression_result<R> {
+  using type = typename R::compatible_bitarray;
+};
+
+template <typename R>
+  requires(!requires { typename R::compatible_bitarray; } &&
+           std::is_default_constructible_v<R> &&
+           requires(R& r, const R& other) { r.assign_range(other); })
+struct bit_expression_result<R> {
+  using type = R;
+};
+
+template <typename T>
+concept bit_eager_operand = bit_word_range<T> && requires { typename bit_expression_result<T>::type; };
+
+template <typename Range, typename Expression>
+constexpr auto evaluate_bit_expression(const Expression& expression) {
+  using result_type = typename bit_expression_result<Range>::type;
+  if constexpr (requires { typename Range::compatible_bitarray; }) {
+    return result_type(expression);
+  } else {
+    result_type result;
+    result.assign_range(expression);
+    return result;
+  }
+}
+
+}  // namespace detail
+
+template <detail::bit_eager_operand Range>
+constexpr auto operator~(const Range& range) {
+  return detail::evaluate_bit_expression<Range>(make_bit_expression(std::bit_not<>{}, range));
+}
+
+template <detail::bit_eager_operand Lhs, detail::bit_word_range Rhs>
+constexpr auto operator&(const Lhs& lhs, const Rhs& rhs) {
+  return detail::evaluate_bit_expression<Lhs>(make_bit_expression(std::bit_and<>{}, lhs, rhs));
+}
+
+template <detail::bit_eager_operand Lhs, detail::bit_word_range Rhs>
+constexpr auto operator|(const Lhs& lhs, const Rhs& rhs) {
+  return detail::evaluate_bit_expression<Lhs>(make_bit_expression(std::bit_or<>{}, lhs, rhs));
+}
+
+template <detail::bit_eager_operand Lhs, detail::bit_word_range Rhs>
+constexpr auto operator^(const Lhs& lhs, const Rhs& rhs) {
+  return detail::evaluate_bit_expression<Lhs>(make_bit_expression(std::bit_xor<>{}, lhs, rhs));
+}
+
+template <detail::bit_expression_c Range>
+constexpr auto operator~(Range&& range) {
+  return make_bit_expression(std::bit_not<>{}, std::forward<Range>(range));
+}
+
+template <detail::bit_expression_operand Lhs, detail::bit_expression_operand Rhs>
+  requires(detail::bit_expression_c<Lhs> || detail::bit_expression_c<Rhs>)
+constexpr auto operator&(Lhs&& lhs, Rhs&& rhs) {
+  return make_bit_expression(std::bit_and<>{}, std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+template <detail::bit_expression_operand Lhs, detail::bit_expression_operand Rhs>
+  requires(detail::bit_expression_c<Lhs> || detail::bit_expression_c<Rhs>)
+constexpr auto operator|(Lhs&& lhs, Rhs&& rhs) {
+  return make_bit_expression(std::bit_or<>{}, std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+template <detail::bit_expression_operand Lhs, detail::bit_expression_operand Rhs>
+  requires(detail::bit_expression_c<Lhs> || detail::bit_expression_c<Rhs>)
+constexpr auto operator^(Lhs&& lhs, Rhs&& rhs) {
+  return make_bit_expression(std::bit_xor<>{}, std::forward<Lhs>(lhs), std::forward<Rhs>(rhs));
+}
+
+/**
+ * @brief Random access iterator over the bits of an expression
+ */
+template <typename Expression>
+class bit_expression_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = bit_value;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = bit_value;
+  using size_type = std::size_t;
+
+ private:
+  const Expression* expression_ = nullptr;
+  size_type position_ = 0;
+
+ public:
+  constexpr bit_expression_iterator() = default;
+  constexpr bit_expression_iterator(const Expression* expression, size_type position)
+      : expression_(expression), position_(position) {}
+
+  constexpr const Expression& expression() const noexcept {
+    return *expression_;
+  }
+
+  constexpr size_type position() const noexcept {
+    return position_;
+  }
+
+  constexpr reference operator*() const {
+    return (expression_->word(position_, 1) & 1) ? bit1 : bit0;
+  }
+
+  constexpr reference operator[](difference_type n) const {
+    return *(*this + n);
+  }
+
+  constexpr bit_expression_iterator& operator++() {
+    ++position_;
+    return *this;
+  }
+
+  constexpr bit_expression_iterator operator++(int) {
+    bit_expression_iterator old = *this;
+    ++position_;
+    return old;
+  }
+
+  constexpr bit_expression_iterator& operator--() {
+    --position_;
+    return *this;
+  }
+
+  constexpr bit_expression_iterator operator--(int) {
+    bit_expression_iterator old = *this;
+    --position_;
+    return old;
+  }
+
+  constexpr bit_expression_iterator& operator+=(difference_type n) {
+    position_ += n;
+    return *this;
+  }
+
+  constexpr bit_expression_iterator& operator-=(difference_type n) {
+    position_ -= n;
+    return *this;
+  }
+
+  friend constexpr bit_expression_iterator operator+(bit_expression_iterator it, difference_type n) {
+    return it += n;
+  }
+
+  friend constexpr bit_expression_iterator operator+(difference_type n, bit_expression_iterator it) {
+    return it += n;
+  }
+
+  friend constexpr bit_expression_iterator operator-(bit_expression_iterator it, difference_type n) {
+    return it -= n;
+  }
+
+  friend constexpr difference_type operator-(const bit_expression_iterator& lhs, const bit_expression_iterator& rhs) {
+    return static_cast<difference_type>(lhs.position_) - static_cast<difference_type>(rhs.position_);
+  }
+
+  friend constexpr bool operator==(const bit_expression_iterator& lhs, const bit_expression_iterator& rhs) {
+    return lhs.position_ == rhs.position_;
+  }
+
+  friend constexpr auto operator<=>(const bit_expression_iterator& lhs, const bit_expression_iterator& rhs) {
+    return lhs.position_ <=> rhs.position_;
+  }
+};
+
+namespace detail {
+
+// Reads len bits at it into the low bits of a word, upper bits unspecified
+template <typename Word, typename Expression>
+constexpr Word expression_read_word(const bit_expression_iterator<Expression>& it, std::size_t len) {
+  return static_cast<Word>(it.expression().word(it.position(), len));
+}
+
+template <typename Word, typename RandomAccessIt>
+constexpr Word expression_read_word(const bit_iterator<RandomAccessIt>& it, std::size_t len) {
+  return get_word<Word>(it, len);
+}
+
+template <typename It>
+struct expression_iterator_word {
+  using type = std::remove_cv_t<typename It::word_type>;
+};
+
+template <typename Expression>
+struct expression_iterator_word<bit_expression_iterator<Expression>> {
+  using type = typename Expression::word_type;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Evaluates the expression bits [first, last) into d_first
+ */
+template <typename Expression, typename RandomAccessIt>
+constexpr bit_iterator<RandomAccessIt> copy(
+    const bit_expression_iterator<Expression>& first,
+    const bit_expression_iterator<Expression>& last,
+    bit_iterator<RandomAccessIt> d_first) {
+  using word_type = typename Expression::word_type;
+  using size_type = typename bit_expression_iterator<Expression>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+  constexpr bool same_word = std::is_same_v<word_type, std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>>;
+
+  const Expression& expression = first.expression();
+  size_type pos = first.position();
+  size_type remaining = distance(first, last);
+
+  if (same_word && d_first.position() == 0 && expression.aligned(pos)) {
+    // Straight word loop, vectorized by the compiler
+    RandomAccessIt it = d_first.base();
+    for (; remaining >= digits; remaining -= digits, pos += digits) {
+      *it++ = expression.aligned_word(pos);
+    }
+    d_first = bit_iterator<RandomAccessIt>(it);
+  } else {
+    for (; remaining >= digits; remaining -= digits, pos += digits) {
+      write_word(expression.word(pos), d_first, digits);
+      d_first += digits;
+    }
+  }
+  if (remaining) {
+    write_word(expression.word(pos, remaining), d_first, remaining);
+    d_first += remaining;
+  }
+  return d_first;
+}
+
+/**
+ * @brief Compares a range with an expression (in either order) word by word
+ */
+template <typename It1, typename It2>
+  requires(detail::bit_expression_iterator_c<It1> || detail::bit_expression_iterator_c<It2>)
+constexpr bool equal(const It1& first, const It1& last, It2 d_first) {
+  using word_type1 = typename detail::expression_iterator_word<It1>::type;
+  using word_type2 = typename detail::expression_iterator_word<It2>::type;
+  // Compare in chunks of the narrower word
+  using word_type = std::conditional_t<(bitsof<word_type1>() <= bitsof<word_type2>()), word_type1, word_type2>;
+  constexpr std::size_t digits = bitsof<word_type>();
+
+  It1 it = first;
+  std::size_t remaining = distance(first, last);
+  for (; remaining >= digits; remaining -= digits, it += digits, d_first += digits) {
+    if (detail::expression_read_word<word_type>(it, digits) != detail::expression_read_word<word_type>(d_first, digits)) {
+      return false;
+    }
+  }
+  if (remaining) {
+    const word_type diff = detail::expression_read_word<word_type>(it, remaining) ^
+                           detail::expression_read_word<word_type>(d_first, remaining);
+    return (diff & _mask<word_type>(remaining)) == 0;
+  }
+  return true;
+}
+
+/**
+ * @brief Counts the bits of the expression equal to value
+ */
+template <typename Expression>
+constexpr typename bit_expression_iterator<Expression>::difference_type count(
+    const bit_expression_iterator<Expression>& first,
+    const bit_expression_iterator<Expression>& last,
+    bit_value value) {
+  using word_type = typename Expression::word_type;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_expression_iterator<Expression>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  const Expression& expression = first.expression();
+  size_type pos = first.position();
+  size_type remaining = distance(first, last);
+  size_type ones = 0;
+  if (expression.aligned(pos)) {
+    for (; remaining >= digits; remaining -= digits, pos += digits) {
+      ones += std::popcount(static_cast<uword_type>(expression.aligned_word(pos)));
+    }
+  } else {
+    for (; remaining >= digits; remaining -= digits, pos += digits) {
+      ones += std::popcount(static_cast<uword_type>(expression.word(pos)));
+    }
+  }
+  if (remaining) {
+    ones += std::popcount(static_cast<uword_type>(expression.word(pos, remaining) & _mask<word_type>(remaining)));
+  }
+  const size_type total = distance(first, last);
+  return static_cast<typename bit_expression_iterator<Expression>::difference_type>(value == bit1 ? ones : total - ones);
+}
+
+/**
+ * @brief Finds the first bit of the expression equal to value
+ */
+template <typename Expression>
+constexpr bit_expression_iterator<Expression> find(
+    const bit_expression_iterator<Expression>& first,
+    const bit_expression_iterator<Expression>& last,
+    bit_value value) {
+  using word_type = typename Expression::word_type;
+  using uword_type = std::make_unsigned_t<word_type>;
+  using size_type = typename bit_expression_iterator<Expression>::size_type;
+  constexpr size_type digits = bitsof<word_type>();
+
+  const Expression& expression = first.expression();
+  size_type pos = first.position();
+  const size_type end = last.position();
+  while (pos < end) {
+    const size_type len = std::min(digits, end - pos);
+    uword_type bits = static_cast<uword_type>(expression.word(pos, len));
+    if (value == bit0) {
+      bits = static_cast<uword_type>(~bits);
+    }
+    if (len < digits) {
+      bits &= _mask<uword_type>(len);
+    }
+    if (bits) {
+      return bit_expression_iterator<Expression>(&expression, pos + std::countr_zero(bits));
+    }
+    pos += len;
+  }
+  return last;
+}
+
+}  // namespace bit
+
+#endif  // _BIT_EXPRESSION_HPP_INCLUDED
@@ -0,0 +1,325 @@
+// ======================== HIERARCHICAL BIT VECTOR ========================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_hierarchical_vector.hpp
+// Description: Bit vector with summary levels for fast search of sparse bits
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_HIERARCHICAL_VECTOR_HPP_INCLUDED
+#define _BIT_HIERARCHICAL_VECTOR_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+/**
+ * @brief A fixed size bit vector which finds set bits in O(log_w n) word
+ *        reads however sparse they are
+ *
+ * Level 0 holds the bits. Each level above holds one bit per word of the
+ * level below, set when that word is non-zero, until a level fits in a
+ * single word. find_next and find_prev climb until a level has a set bit
+ * past the start word and descend along it, so they read at most two words
+ * per level. set and reset only touch the levels above when a word changes
+ * between zero and non-zero.
+ *
+ * Bits are written through set and reset rather than references so that
+ * the summaries stay exact. Iteration yields the positions of the set bits.
+ *
+ * @tparam W The word type of every level
+ */
+template <std::unsigned_integral W = std::uint64_t>
+class hierarchical_bit_vector {
+ public:
+  using word_type = W;
+  using size_type = std::size_t;
+  using value_type = size_type;
+
+ private:
+  static constexpr size_type digits = binary_digits<W>::value;
+
+  std::vector<std::vector<W>> levels_;
+  size_type size_ = 0;
+  size_type count_ = 0;
+
+  static constexpr W bit_mask(size_type pos) noexcept {
+    return static_cast<W>(W{1} << (pos % digits));
+  }
+
+  // Recomputes every summary level from level 0
+  void summarize() {
+    for (size_type k = 1; k < levels_.size(); ++k) {
+      const std::vector<W>& below = levels_[k - 1];
+      std::vector<W>& level = levels_[k];
+      std::fill(level.begin(), level.end(), W{0});
+      for (size_type i = 0; i < below.size(); ++i) {
+        if (below[i]) {
+          level[i / digits] |= bit_mask(i);
+        }
+      }
+    }
+    count_ = 0;
+    if (!levels_.empty()) {
+      for (W word : levels_[0]) {
+        count_ += static_cast<size_type>(std::popcount(word));
+      }
+    }
+  }
+
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = size_type;
+
+   private:
+    const hierarchical_bit_vector* bits_ = nullptr;
+    size_type pos_ = 0;
+
+   public:
+    const_iterator() = default;
+    const_iterator(const hierarchical_bit_vector* bits, size_type pos) : bits_(bits), pos_(pos) {}
+
+    reference operator*() const {
+      return pos_;
+    }
+
+    const_iterator& operator++() {
+      pos_ = bits_->find_next(pos_ + 1);
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.pos_ == rhs.pos_;
+    }
+  };
+  using iterator = const_iterator;
+
+  hierarchical_bit_vector() = default;
+
+  explicit hierarchical_bit_vector(size_type size, bit_value value = bit0) : size_(size) {
+    size_type words = (size + digits - 1) / digits;
+    while (words > 0) {
+      levels_.emplace_back(words, W{0});
+      if (words == 1) {
+        break;
+      }
+      words = (words + digits - 1) / digits;
+    }
+    fill(value);
+  }
+
+  /**
+   * @brief Copies a bit range such as bit_vector, bit_span or bit_array
+   */
+  template <bit_sized_range Range>
+  explicit hierarchical_bit_vector(const Range& bits) : hierarchical_bit_vector(std::ranges::size(bits)) {
+    if (size_) {
+      ::bit::copy(std::ranges::begin(bits), std::ranges::end(bits), bit_iterator<W*>(levels_[0].data()));
+      summarize();
+    }
+  }
+
+  size_type size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return 0 == size_;
+  }
+
+  /**
+   * @brief Number of levels including the bits themselves
+   */
+  size_type depth() const noexcept {
+    return levels_.size();
+  }
+
+  const_iterator begin() const {
+    return const_iterator(this, find_next(0));
+  }
+
+  const_iterator end() const {
+    return const_iterator(this, size_);
+  }
+
+  bit_value test(size_type pos) const noexcept {
+    assert(pos < size_);
+    return (levels_[0][pos / digits] & bit_mask(pos)) ? bit1 : bit0;
+  }
+
+  bit_value operator[](size_type pos) const noexcept {
+    return test(pos);
+  }
+
+  void set(size_type pos, bit_value value = bit1) noexcept {
+    assert(pos < size_);
+    if (value == bit0) {
+      reset(pos);
+      return;
+    }
+    W& word = levels_[0][pos / digits];
+    if (word & bit_mask(pos)) {
+      return;
+    }
+    ++count_;
+    for (size_type k = 0; k < levels_.size(); ++k, pos /= digits) {
+      W& w = levels_[k][pos / digits];
+      const bool was_zero = (w == 0);
+      w |= bit_mask(pos);
+      if (!was_zero) {
+        break;
+      }
+    }
+  }
+
+  void reset(size_type pos) noexcept {
+    assert(pos < size_);
+    if (!(levels_[0][pos / digits] & bit_mask(pos))) {
+      return;
+    }
+    --count_;
+    for (size_type k = 0; k < levels_.size(); ++k, pos /= digits) {
+      W& w = levels_[k][pos / digits];
+      w &= static_cast<W>(~bit_mask(pos));
+      if (w != 0) {
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Sets every bit to value
+   */
+  void fill(bit_value value) {
+    if (levels_.empty()) {
+      return;
+    }
+    std::vector<W>& bits = levels_[0];
+    std::fill(bits.begin(), bits.end(), (value == bit1) ? static_cast<W>(~W{0}) : W{0});
+    if (value == bit1 && size_ % digits) {
+      bits.back() = _mask<W>(size_ % digits);
+    }
+    summarize();
+  }
+
+  /**
+   * @brief Clears every bit
+   */
+  void clear() {
+    fill(bit0);
+  }
+
+  /**
+   * @brief Number of bits equal to value, in constant time
+   */
+  size_type count(bit_value value = bit1) const noexcept {
+    return (value == bit1) ? count_ : size_ - count_;
+  }
+
+  /**
+   * @brief Position of the first set bit at or after pos, or size() if none
+   */
+  size_type find_next(size_type pos) const noexcept {
+    if (pos >= size_) {
+      return size_;
+    }
+    // Climb until a word holds a set bit at or after pos
+    size_type k = 0;
+    for (;; ++k) {
+      if (k == levels_.size()) {
+        return size_;
+      }
+      const std::vector<W>& level = levels_[k];
+      const size_type i = pos / digits;
+      const W word = static_cast<W>(level[i] & (static_cast<W>(~W{0}) << (pos % digits)));
+      if (word) {
+        pos = i * digits + static_cast<size_type>(std::countr_zero(word));
+        break;
+      }
+      pos = i + 1;
+      if (pos >= level.size()) {
+        return size_;
+      }
+    }
+    // Descend along the lowest set bit of each level
+    while (k-- > 0) {
+      pos = pos * digits + static_cast<size_type>(std::countr_zero(levels_[k][pos]));
+    }
+    return pos;
+  }
+
+  /**
+   * @brief Position of the last set bit at or before pos, or size() if none
+   */
+  size_type find_prev(size_type pos) const noexcept {
+    if (size_ == 0) {
+      return size_;
+    }
+    pos = std::min(pos, size_ - 1);
+    size_type k = 0;
+    for (;; ++k) {
+      if (k == levels_.size()) {
+        return size_;
+      }
+      const size_type i = pos / digits;
+      const W word = static_cast<W>(levels_[k][i] & (static_cast<W>(~W{0}) >> (digits - 1 - pos % digits)));
+      if (word) {
+        pos = i * digits + digits - 1 - static_cast<size_type>(std::countl_zero(word));
+        break;
+      }
+      if (i == 0) {
+        return size_;
+      }
+      pos = i - 1;
+    }
+    while (k-- > 0) {
+      pos = pos * digits + digits - 1 - static_cast<size_type>(std::countl_zero(levels_[k][pos]));
+    }
+    return pos;
+  }
+
+  /**
+   * @brief Position of the first bit equal to value, or size() if none
+   */
+  size_type find(bit_value value = bit1) const noexcept {
+    if (value == bit1) {
+      return find_next(0);
+    }
+    for (size_type i = 0; i < (levels_.empty() ? 0 : levels_[0].size()); ++i) {
+      const W word = static_cast<W>(~levels_[0][i]);
+      if (word) {
+        return std::min(size_, i * digits + static_cast<size_type>(std::countr_zero(word)));
+      }
+    }
+    return size_;
+  }
+
+  friend bool operator==(const hierarchical_bit_vector& lhs, const hierarchical_bit_vector& rhs) {
+    return lhs.size_ == rhs.size_ && lhs.levels_ == rhs.levels_;
+  }
+};
+
+}  // namespace bit
+
+#endif  // _BIT_HIERARCHICAL_VECTOR_HPP_INCLUDED
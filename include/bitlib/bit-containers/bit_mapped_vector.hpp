@@ -0,0 +1,382 @@
+// ============================ MAPPED BIT VECTOR =========================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_mapped_vector.hpp
+// Description: Bit vector backed by a memory-mapped file
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_MAPPED_VECTOR_HPP_INCLUDED
+#define _BIT_MAPPED_VECTOR_HPP_INCLUDED
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit_span.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+/**
+ * @brief Access pattern hints forwarded to madvise
+ */
+enum class map_advice {
+  normal,
+  sequential,
+  random,
+  willneed,
+  dontneed
+};
+
+/**
+ * @brief A bit vector whose words live in a memory-mapped file
+ *
+ * Opening maps the file instead of reading it, so it takes constant time
+ * regardless of the file size and pages are loaded on first access. The
+ * file holds the raw words with no header. A const WordType maps the file
+ * read-only; otherwise it is mapped shared read-write, created if missing,
+ * and writes reach the file (sync() forces them out).
+ *
+ * Iterators are plain bit_iterators over the mapping, so every algorithm
+ * works on it unchanged. They are invalidated by resize().
+ *
+ * @tparam WordType The word type of the file. const for a read-only mapping.
+ */
+template <typename WordType = std::uintptr_t>
+class mapped_bit_vector {
+ public:
+  using word_type = WordType;
+  using value_type = bit_value;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = bit_reference<WordType&>;
+  using const_reference = bit_value;
+  using iterator = bit_iterator<WordType*>;
+  using const_iterator = bit_iterator<const WordType*>;
+
+ private:
+  static constexpr bool writable = !std::is_const_v<WordType>;
+  static constexpr size_type digits = bitsof<std::remove_cv_t<WordType>>();
+
+  int fd_ = -1;
+  WordType* words_ = nullptr;
+  size_type size_ = 0;
+  size_type mapped_words_ = 0;
+
+  static size_type word_count(size_type bits) noexcept {
+    return (bits + digits - 1) / digits;
+  }
+
+  [[noreturn]] static void fail(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+  }
+
+  // Maps the first words of the file, nullptr for none
+  WordType* map_words(size_type words) const {
+    if (words == 0) {
+      return nullptr;
+    }
+    const int prot = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* addr = ::mmap(nullptr, words * sizeof(WordType), prot, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+      fail("mapped_bit_vector: mmap");
+    }
+    return static_cast<WordType*>(addr);
+  }
+
+  void map(size_type words) {
+    words_ = map_words(words);
+    mapped_words_ = words;
+  }
+
+  void truncate(size_type words) const {
+    if (::ftruncate(fd_, static_cast<off_t>(words * sizeof(WordType))) == -1) {
+      fail("mapped_bit_vector: ftruncate");
+    }
+  }
+
+  void unmap() noexcept {
+    if (words_) {
+      ::munmap(const_cast<std::remove_cv_t<WordType>*>(words_), mapped_words_ * sizeof(WordType));
+      words_ = nullptr;
+    }
+    mapped_words_ = 0;
+  }
+
+  void release() noexcept {
+    unmap();
+    if (fd_ != -1) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+    size_ = 0;
+  }
+
+  void open(const std::filesystem::path& path) {
+    fd_ = ::open(path.c_str(), writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if (fd_ == -1) {
+      fail("mapped_bit_vector: open");
+    }
+  }
+
+  size_type file_bytes() const {
+    struct stat st;
+    if (::fstat(fd_, &st) == -1) {
+      fail("mapped_bit_vector: fstat");
+    }
+    return static_cast<size_type>(st.st_size);
+  }
+
+ public:
+  mapped_bit_vector() = default;
+
+  /**
+   * @brief Maps every whole word of the file
+   */
+  explicit mapped_bit_vector(const std::filesystem::path& path) {
+    open(path);
+    try {
+      const size_type words = file_bytes() / sizeof(WordType);
+      size_ = words * digits;
+      map(words);
+    } catch (...) {
+      release();
+      throw;
+    }
+  }
+
+  /**
+   * @brief Maps the first size bits of the file
+   *
+   * A writable file is grown with zero bits, or truncated, to exactly the
+   * words needed. A read-only file must already hold size bits.
+   */
+  mapped_bit_vector(const std::filesystem::path& path, size_type size) {
+    open(path);
+    try {
+      const size_type words = word_count(size);
+      if constexpr (writable) {
+        truncate(words);
+      } else if (file_bytes() < words * sizeof(WordType)) {
+        throw std::invalid_argument("mapped_bit_vector: file is smaller than the requested size");
+      }
+      size_ = size;
+      map(words);
+    } catch (...) {
+      release();
+      throw;
+    }
+  }
+
+  mapped_bit_vector(const mapped_bit_vector&) = delete;
+  mapped_bit_vector& operator=(const mapped_bit_vector&) = delete;
+
+  mapped_bit_vector(mapped_bit_vector&& other) noexcept
+      : fd_(std::exchange(other.fd_, -1)),
+        words_(std::exchange(other.words_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        mapped_words_(std::exchange(other.mapped_words_, 0)) {
+  }
+
+  mapped_bit_vector& operator=(mapped_bit_vector&& other) noexcept {
+    if (this != &other) {
+      release();
+      fd_ = std::exchange(other.fd_, -1);
+      words_ = std::exchange(other.words_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      mapped_words_ = std::exchange(other.mapped_words_, 0);
+    }
+    return *this;
+  }
+
+  ~mapped_bit_vector() {
+    release();
+  }
+
+  bool is_open() const noexcept {
+    return fd_ != -1;
+  }
+
+  size_type size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return 0 == size_;
+  }
+
+  WordType* data() noexcept {
+    return words_;
+  }
+
+  const WordType* data() const noexcept {
+    return words_;
+  }
+
+  iterator begin() noexcept {
+    return iterator(words_);
+  }
+
+  iterator end() noexcept {
+    return begin() + size_;
+  }
+
+  const_iterator begin() const noexcept {
+    return cbegin();
+  }
+
+  const_iterator end() const noexcept {
+    return cend();
+  }
+
+  const_iterator cbegin() const noexcept {
+    return const_iterator(words_);
+  }
+
+  const_iterator cend() const noexcept {
+    return cbegin() + size_;
+  }
+
+  reference operator[](size_type pos) {
+    return begin()[pos];
+  }
+
+  const_reference operator[](size_type pos) const {
+    return cbegin()[pos];
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("Position is out of range");
+    }
+    return begin()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Position is out of range");
+    }
+    return cbegin()[pos];
+  }
+
+  /**
+   * @brief The mapped bits as a bit_span
+   */
+  bit_span<WordType> span() noexcept {
+    return bit_span<WordType>(words_, size_);
+  }
+
+  bit_span<const WordType> span() const noexcept {
+    return bit_span<const WordType>(words_, size_);
+  }
+
+  /**
+   * @brief Grows or shrinks the file and remaps it
+   *
+   * Bits added past the old size are set to value. If the file cannot be
+   * resized or remapped the old mapping and size are kept.
+   */
+  void resize(size_type new_size, bit_value value = bit0)
+    requires(writable)
+  {
+    const size_type old_size = size_;
+    const size_type words = word_count(new_size);
+    if (words > mapped_words_) {
+      // Grow the file first so the new mapping is backed
+      truncate(words);
+      WordType* grown = nullptr;
+      try {
+        grown = map_words(words);
+      } catch (...) {
+        // Best effort: drop the words just added
+        [[maybe_unused]] const int restored = ::ftruncate(fd_, static_cast<off_t>(mapped_words_ * sizeof(WordType)));
+        throw;
+      }
+      unmap();
+      words_ = grown;
+      mapped_words_ = words;
+    } else if (words < mapped_words_) {
+      // Map the smaller range before cutting the file under the old one
+      WordType* shrunk = map_words(words);
+      try {
+        truncate(words);
+      } catch (...) {
+        if (shrunk) {
+          ::munmap(shrunk, words * sizeof(WordType));
+        }
+        throw;
+      }
+      unmap();
+      words_ = shrunk;
+      mapped_words_ = words;
+    }
+    size_ = new_size;
+    if (new_size > old_size) {
+      ::bit::fill(begin() + old_size, end(), value);
+    }
+  }
+
+  /**
+   * @brief Hints the kernel how the mapping will be accessed
+   */
+  void advise(map_advice advice) const {
+    if (!words_) {
+      return;
+    }
+    int flag = MADV_NORMAL;
+    switch (advice) {
+      case map_advice::normal:
+        flag = MADV_NORMAL;
+        break;
+      case map_advice::sequential:
+        flag = MADV_SEQUENTIAL;
+        break;
+      case map_advice::random:
+        flag = MADV_RANDOM;
+        break;
+      case map_advice::willneed:
+        flag = MADV_WILLNEED;
+        break;
+      case map_advice::dontneed:
+        flag = MADV_DONTNEED;
+        break;
+    }
+    if (::madvise(const_cast<std::remove_cv_t<WordType>*>(words_), mapped_words_ * sizeof(WordType), flag) == -1) {
+      fail("mapped_bit_vector: madvise");
+    }
+  }
+
+  /**
+   * @brief Writes modified pages back to the file, blocking until done
+   */
+  void sync() const
+    requires(writable)
+  {
+    if (words_ && ::msync(words_, mapped_words_ * sizeof(WordType), MS_SYNC) == -1) {
+      fail("mapped_bit_vector: msync");
+    }
+  }
+};
+
+static_assert(bit_sized_range<mapped_bit_vector<std::uint64_t>>, "mapped_bit_vector does not satisfy bit_sized_range concept!");
+static_assert(bit_sized_range<mapped_bit_vector<const std::uint64_t>>, "mapped_bit_vector does not satisfy bit_sized_range concept!");
+
+}  // namespace bit
+
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#endif  // _BIT_MAPPED_VECTOR_HPP_INCLUDED
@@ -0,0 +1,325 @@
+// =============================== BIT MATRIX =============================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_matrix.hpp
+// Description: Dense bit matrix with transpose and GF(2) arithmetic
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_MATRIX_HPP_INCLUDED
+#define _BIT_MATRIX_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit_span.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+namespace detail {
+
+// Transposes a digits x digits block in place, bit c of block[r] being
+// element (r, c). log2(digits) butterfly rounds, each exchanging the
+// off-diagonal quadrants of every sub-block in parallel.
+template <typename T>
+constexpr void transpose_block(std::array<T, binary_digits<T>::value>& block) noexcept {
+  static_assert(std::is_unsigned_v<T>);
+  constexpr std::size_t digits = binary_digits<T>::value;
+  T m = static_cast<T>(static_cast<T>(~T{0}) >> (digits / 2));
+  for (std::size_t j = digits / 2; j != 0; j >>= 1, m = static_cast<T>(m ^ static_cast<T>(m << j))) {
+    for (std::size_t k = 0; k < digits; k = ((k | j) + 1) & ~j) {
+      const T t = static_cast<T>((static_cast<T>(block[k] >> j) ^ block[k | j]) & m);
+      block[k] ^= static_cast<T>(t << j);
+      block[k | j] ^= t;
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief A dense rows x cols matrix of bits
+ *
+ * Rows are stored one after another, each starting on a word boundary and
+ * padded with zero bits to a whole number of words, so rows are plain
+ * bit_spans and row operations run a word at a time. Arithmetic is over
+ * GF(2): addition is xor and multiplication is and.
+ *
+ * @tparam WordType The word type of the storage
+ */
+template <typename WordType = std::uint64_t>
+class bit_matrix {
+ public:
+  using word_type = WordType;
+  using value_type = bit_value;
+  using size_type = std::size_t;
+  using reference = bit_reference<WordType&>;
+  using const_reference = bit_value;
+  using row_type = bit_span<WordType>;
+  using const_row_type = bit_span<const WordType>;
+
+ private:
+  using uword_type = std::make_unsigned_t<WordType>;
+  static constexpr size_type digits = bitsof<WordType>();
+  // Columns of A consumed per lookup table in the Four Russians multiply
+  static constexpr size_type m4rm_bits = 8;
+  static_assert(digits % m4rm_bits == 0, "word size must be a multiple of 8 bits");
+
+  size_type rows_ = 0;
+  size_type cols_ = 0;
+  size_type stride_ = 0;
+  std::vector<WordType> words_;
+
+  WordType* row_words(size_type r) noexcept {
+    return words_.data() + r * stride_;
+  }
+  const WordType* row_words(size_type r) const noexcept {
+    return words_.data() + r * stride_;
+  }
+
+  // Clears the padding bits past the last column of every row
+  void clear_padding() noexcept {
+    if (cols_ % digits) {
+      for (size_type r = 0; r < rows_; ++r) {
+        row_words(r)[stride_ - 1] &= _mask<WordType>(cols_ % digits);
+      }
+    }
+  }
+
+ public:
+  bit_matrix() = default;
+
+  bit_matrix(size_type rows, size_type cols, bit_value value = bit0)
+      : rows_(rows),
+        cols_(cols),
+        stride_((cols + digits - 1) / digits),
+        words_(rows * stride_, (value == bit1) ? static_cast<WordType>(~WordType{0}) : WordType{0}) {
+    clear_padding();
+  }
+
+  static bit_matrix identity(size_type n) {
+    bit_matrix result(n, n);
+    for (size_type i = 0; i < n; ++i) {
+      result(i, i) = bit1;
+    }
+    return result;
+  }
+
+  size_type rows() const noexcept {
+    return rows_;
+  }
+
+  size_type cols() const noexcept {
+    return cols_;
+  }
+
+  /**
+   * @brief Number of words per row
+   */
+  size_type stride() const noexcept {
+    return stride_;
+  }
+
+  WordType* data() noexcept {
+    return words_.data();
+  }
+
+  const WordType* data() const noexcept {
+    return words_.data();
+  }
+
+  reference operator()(size_type r, size_type c) {
+    assert(r < rows_ && c < cols_);
+    return bit_iterator<WordType*>(row_words(r))[c];
+  }
+
+  bit_value operator()(size_type r, size_type c) const {
+    assert(r < rows_ && c < cols_);
+    return bit_iterator<const WordType*>(row_words(r))[c];
+  }
+
+  row_type row(size_type r) {
+    assert(r < rows_);
+    return row_type(row_words(r), cols_);
+  }
+
+  const_row_type row(size_type r) const {
+    assert(r < rows_);
+    return const_row_type(row_words(r), cols_);
+  }
+
+  void swap_rows(size_type a, size_type b) noexcept {
+    std::swap_ranges(row_words(a), row_words(a) + stride_, row_words(b));
+  }
+
+  /**
+   * @brief row(dst) ^= row(src)
+   */
+  void add_row(size_type dst, size_type src) noexcept {
+    WordType* d = row_words(dst);
+    const WordType* s = row_words(src);
+    for (size_type w = 0; w < stride_; ++w) {
+      d[w] ^= s[w];
+    }
+  }
+
+  /**
+   * @brief The transposed matrix, built digits x digits blocks at a time
+   */
+  bit_matrix transpose() const {
+    bit_matrix result(cols_, rows_);
+    std::array<uword_type, digits> block;
+    for (size_type br = 0; br < rows_; br += digits) {
+      const size_type block_rows = std::min(digits, rows_ - br);
+      for (size_type bw = 0; bw < stride_; ++bw) {
+        for (size_type i = 0; i < digits; ++i) {
+          block[i] = (i < block_rows) ? static_cast<uword_type>(row_words(br + i)[bw]) : uword_type{0};
+        }
+        detail::transpose_block(block);
+        const size_type block_cols = std::min(digits, cols_ - bw * digits);
+        for (size_type i = 0; i < block_cols; ++i) {
+          result.row_words(bw * digits + i)[br / digits] = static_cast<WordType>(block[i]);
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Matrix-vector product A x over GF(2)
+   *
+   * @param x A bit range of cols() bits
+   * @return A bit_vector of rows() bits
+   */
+  template <bit_sized_range Range>
+  bit_vector<WordType> multiply(const Range& x) const {
+    if (std::ranges::size(x) != cols_) {
+      throw std::invalid_argument("bit_matrix: vector length does not match the column count");
+    }
+    std::vector<WordType> xw(stride_, WordType{0});
+    ::bit::copy(std::ranges::begin(x), std::ranges::end(x), bit_iterator<WordType*>(xw.data()));
+    bit_vector<WordType> y(rows_);
+    auto out = y.begin();
+    for (size_type r = 0; r < rows_; ++r) {
+      const WordType* row = row_words(r);
+      uword_type acc = 0;
+      for (size_type w = 0; w < stride_; ++w) {
+        acc ^= static_cast<uword_type>(row[w] & xw[w]);
+      }
+      out[r] = (std::popcount(acc) & 1) ? bit1 : bit0;
+    }
+    return y;
+  }
+
+  /**
+   * @brief Matrix product over GF(2) by the Method of Four Russians
+   *
+   * For every 8 rows of rhs a table of all 256 sums of them is built once;
+   * each row of the result then adds one table entry per 8 columns of lhs
+   * instead of up to 8 rows.
+   */
+  friend bit_matrix operator*(const bit_matrix& lhs, const bit_matrix& rhs) {
+    if (lhs.cols_ != rhs.rows_) {
+      throw std::invalid_argument("bit_matrix: inner dimensions do not match");
+    }
+    bit_matrix result(lhs.rows_, rhs.cols_);
+    const size_type stride = rhs.stride_;
+    std::vector<WordType> table((size_type{1} << m4rm_bits) * stride);
+    for (size_type g = 0; g < lhs.cols_; g += m4rm_bits) {
+      const size_type k = std::min(m4rm_bits, lhs.cols_ - g);
+      // table[i] = sum of rows g + j of rhs for each bit j set in i
+      std::fill(table.begin(), table.begin() + stride, WordType{0});
+      for (size_type i = 1; i < (size_type{1} << k); ++i) {
+        const WordType* prev = table.data() + (i & (i - 1)) * stride;
+        const WordType* add = rhs.row_words(g + std::countr_zero(i));
+        WordType* entry = table.data() + i * stride;
+        for (size_type w = 0; w < stride; ++w) {
+          entry[w] = prev[w] ^ add[w];
+        }
+      }
+      for (size_type r = 0; r < lhs.rows_; ++r) {
+        const size_type index = static_cast<size_type>(
+            (static_cast<uword_type>(lhs.row_words(r)[g / digits]) >> (g % digits)) & 0xFF);
+        if (index) {
+          const WordType* entry = table.data() + index * stride;
+          WordType* out = result.row_words(r);
+          for (size_type w = 0; w < stride; ++w) {
+            out[w] ^= entry[w];
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Element-wise sum over GF(2)
+   */
+  friend bit_matrix operator^(bit_matrix lhs, const bit_matrix& rhs) {
+    if (lhs.rows_ != rhs.rows_ || lhs.cols_ != rhs.cols_) {
+      throw std::invalid_argument("bit_matrix: dimensions do not match");
+    }
+    for (size_type i = 0; i < lhs.words_.size(); ++i) {
+      lhs.words_[i] ^= rhs.words_[i];
+    }
+    return lhs;
+  }
+
+  /**
+   * @brief Reduces the matrix in place to reduced row echelon form by
+   *        Gauss-Jordan elimination
+   *
+   * @return The rank
+   */
+  size_type row_reduce() noexcept {
+    size_type pivot = 0;
+    for (size_type c = 0; c < cols_ && pivot < rows_; ++c) {
+      const size_type w = c / digits;
+      const uword_type bit = uword_type{1} << (c % digits);
+      size_type r = pivot;
+      while (r < rows_ && !(static_cast<uword_type>(row_words(r)[w]) & bit)) {
+        ++r;
+      }
+      if (r == rows_) {
+        continue;
+      }
+      swap_rows(pivot, r);
+      const WordType* p = row_words(pivot);
+      for (size_type i = 0; i < rows_; ++i) {
+        WordType* row = row_words(i);
+        if (i != pivot && (static_cast<uword_type>(row[w]) & bit)) {
+          // Columns before c are already zero in the pivot row
+          for (size_type x = w; x < stride_; ++x) {
+            row[x] ^= p[x];
+          }
+        }
+      }
+      ++pivot;
+    }
+    return pivot;
+  }
+
+  size_type rank() const {
+    return bit_matrix(*this).row_reduce();
+  }
+
+  friend bool operator==(const bit_matrix& lhs, const bit_matrix& rhs) {
+    return lhs.rows_ == rhs.rows_ && lhs.cols_ == rhs.cols_ && lhs.words_ == rhs.words_;
+  }
+};
+
+}  // namespace bit
+
+#endif  // _BIT_MATRIX_HPP_INCLUDED
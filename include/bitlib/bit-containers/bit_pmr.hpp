@@ -0,0 +1,152 @@
+// ================================ BIT PMR ================================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_pmr.hpp
+// Description: std::pmr allocator, policy and arena for dynamic bit arrays
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_PMR_HPP_INCLUDED
+#define _BIT_PMR_HPP_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "bitlib/bit-containers/bit_policy.hpp"
+
+namespace bit::pmr {
+
+namespace detail {
+inline std::pmr::memory_resource*& thread_resource() noexcept {
+  thread_local std::pmr::memory_resource* resource = nullptr;
+  return resource;
+}
+}  // namespace detail
+
+/**
+ * @brief The resource default constructed bit::pmr::allocators use on this
+ *        thread: the one installed by set_default_resource or a
+ *        resource_guard, else std::pmr::get_default_resource()
+ */
+inline std::pmr::memory_resource* get_default_resource() noexcept {
+  std::pmr::memory_resource* resource = detail::thread_resource();
+  return resource ? resource : std::pmr::get_default_resource();
+}
+
+/**
+ * @brief Installs resource for this thread only; nullptr restores the
+ *        std::pmr default
+ *
+ * @return The previously installed resource
+ */
+inline std::pmr::memory_resource* set_default_resource(std::pmr::memory_resource* resource) noexcept {
+  return std::exchange(detail::thread_resource(), resource);
+}
+
+/**
+ * @brief Installs a resource for the current thread for the lifetime of
+ *        the guard
+ *
+ * Every bit array with policy::pmr created in the scope, including the
+ * temporaries of expressions, allocates from the resource:
+ * @code
+ * bit::pmr::arena<> arena;
+ * bit::pmr::resource_guard guard(&arena);
+ * @endcode
+ */
+class resource_guard {
+  std::pmr::memory_resource* previous_;
+
+ public:
+  explicit resource_guard(std::pmr::memory_resource* resource) noexcept
+      : previous_(::bit::pmr::set_default_resource(resource)) {}
+  resource_guard(const resource_guard&) = delete;
+  resource_guard& operator=(const resource_guard&) = delete;
+  ~resource_guard() {
+    ::bit::pmr::set_default_resource(previous_);
+  }
+};
+
+/**
+ * @brief A std::pmr::polymorphic_allocator whose default resource is the
+ *        thread's bit::pmr::get_default_resource()
+ */
+template <typename T>
+class allocator : public std::pmr::polymorphic_allocator<T> {
+  using base = std::pmr::polymorphic_allocator<T>;
+
+ public:
+  using value_type = T;
+
+  allocator() noexcept : base(get_default_resource()) {}
+  allocator(std::pmr::memory_resource* resource) noexcept : base(resource) {}
+  allocator(const allocator&) = default;
+  template <typename U>
+  allocator(const allocator<U>& other) noexcept : base(other.resource()) {}
+
+  // Copies take the current thread's resource, like polymorphic_allocator
+  allocator select_on_container_copy_construction() const noexcept {
+    return allocator();
+  }
+
+  template <typename U>
+  struct rebind {
+    using other = allocator<U>;
+  };
+};
+
+/**
+ * @brief A monotonic arena with Bytes of inline space
+ *
+ * Allocation is a pointer bump and deallocation is a no-op; release() or
+ * the destructor frees everything at once. Once the inline buffer is used
+ * up, blocks come from upstream. The default size holds a few hundred
+ * kilobit arrays.
+ */
+template <std::size_t Bytes = 64 * 1024>
+class arena : public std::pmr::memory_resource {
+  alignas(std::max_align_t) std::array<std::byte, Bytes> buffer_;
+  std::pmr::monotonic_buffer_resource resource_;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    return resource_.allocate(bytes, alignment);
+  }
+  void do_deallocate(void*, std::size_t, std::size_t) override {
+  }
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+ public:
+  explicit arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+      : resource_(buffer_.data(), buffer_.size(), upstream) {}
+  arena(const arena&) = delete;
+  arena& operator=(const arena&) = delete;
+
+  /**
+   * @brief Frees every allocation and rewinds to the inline buffer
+   */
+  void release() noexcept {
+    resource_.release();
+  }
+};
+
+}  // namespace bit::pmr
+
+namespace bit::policy {
+
+/**
+ * @brief policy::typical with a bit::pmr::allocator
+ */
+template <typename W>
+struct pmr {
+  using allocator = ::bit::pmr::allocator<std::remove_const_t<W>>;
+  using extension = sign_extend;
+  using truncation = truncate;
+};
+
+}  // namespace bit::policy
+
+#endif  // _BIT_PMR_HPP_INCLUDED
@@ -0,0 +1,283 @@
+// ============================== RANK SELECT =============================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_rank_select.hpp
+// Description: Succinct rank/select index over a bit range
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_RANK_SELECT_HPP_INCLUDED
+#define _BIT_RANK_SELECT_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+namespace detail {
+
+// Position of the k-th (0 based) set bit of word. k must be < popcount(word)
+template <typename T>
+constexpr std::size_t select_in_word(T word, std::size_t k) noexcept {
+  std::size_t pos = 0;
+  for (std::size_t width = binary_digits<T>::value / 2; width > 0; width /= 2) {
+    const std::size_t low = std::popcount(static_cast<T>(word & _mask<T>(width)));
+    if (k >= low) {
+      k -= low;
+      word = static_cast<T>(word >> width);
+      pos += width;
+    }
+  }
+  return pos;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Constant time rank and near constant time select over a bit range
+ *
+ * Poppy style layout: the range is cut into 2048 bit superblocks, each with
+ * a single 64 bit entry holding the number of ones before it (relative to
+ * its 2^32 bit region) and the counts of its first three 512 bit blocks.
+ * Select is narrowed down by sampling the superblock of every 8192nd one
+ * (and zero). The index takes less than 5% of the indexed bits.
+ *
+ * The index does not own the bits. It must be rebuilt after the underlying
+ * range is modified.
+ *
+ * @tparam RandomAccessIt The word iterator of the indexed bit range
+ */
+template <typename RandomAccessIt>
+class rank_select {
+ public:
+  using iterator = bit_iterator<RandomAccessIt>;
+  using word_type = typename iterator::word_type;
+  using size_type = std::size_t;
+
+  static constexpr size_type block_bits = 512;
+  static constexpr size_type superblock_bits = 4 * block_bits;
+  static constexpr std::uint64_t region_bits = std::uint64_t{1} << 32;
+  static constexpr size_type select_sample = 8192;
+
+ private:
+  using uword_type = std::make_unsigned_t<std::remove_cv_t<word_type>>;
+  static constexpr size_type digits = binary_digits<uword_type>::value;
+  static constexpr size_type superblocks_per_region = region_bits / superblock_bits;
+  static_assert(block_bits % digits == 0, "word size must divide the block size");
+
+  iterator first_;
+  size_type size_ = 0;
+  size_type ones_ = 0;
+  // Number of ones before each 2^32 bit region
+  std::vector<std::uint64_t> regions_;
+  // Per superblock: [63:32] ones before it within its region, [29:0] 3 x 10 bit block counts
+  std::vector<std::uint64_t> superblocks_;
+  // Superblock holding every select_sample-th zero [0] and one [1]
+  std::vector<size_type> samples_[2];
+
+  constexpr uword_type word(size_type i) const;
+  constexpr size_type superblock_rank(size_type s, bit_value value) const;
+  constexpr size_type block_count(size_type s, size_type b) const;
+
+ public:
+  rank_select() = default;
+
+  /**
+   * @brief Builds the index over [first, last)
+   */
+  constexpr rank_select(iterator first, iterator last);
+
+  /**
+   * @brief Builds the index over a bit range such as bit_vector or bit_span
+   *
+   * The range must outlive the index, so temporary containers are rejected.
+   */
+  template <bit_sized_range Range>
+    requires std::ranges::borrowed_range<Range>
+  constexpr explicit rank_select(Range&& range)
+      : rank_select(std::ranges::begin(range), std::ranges::end(range)) {
+  }
+
+  constexpr size_type size() const noexcept {
+    return size_;
+  }
+
+  /**
+   * @brief Number of bits equal to value in the whole range
+   */
+  constexpr size_type count(bit_value value = bit1) const noexcept {
+    return (value == bit1) ? ones_ : size_ - ones_;
+  }
+
+  /**
+   * @brief Number of bits equal to value in [0, pos)
+   */
+  constexpr size_type rank(size_type pos, bit_value value = bit1) const;
+
+  /**
+   * @brief Position of the k-th (0 based) bit equal to value,
+   *        or size() if there are not that many
+   */
+  constexpr size_type select(size_type k, bit_value value = bit1) const;
+};
+
+template <bit_sized_range Range>
+  requires std::ranges::borrowed_range<Range>
+rank_select(Range&&) -> rank_select<typename std::ranges::iterator_t<Range>::iterator_type>;
+
+template <typename RandomAccessIt>
+constexpr rank_select<RandomAccessIt>::rank_select(iterator first, iterator last)
+    : first_(first), size_(distance(first, last)) {
+  const size_type words = (size_ + digits - 1) / digits;
+  const size_type superblocks = size_ / superblock_bits + 1;
+  regions_.assign((superblocks - 1) / superblocks_per_region + 1, 0);
+  superblocks_.assign(superblocks, 0);
+
+  std::uint64_t ones = 0;
+  for (size_type s = 0; s < superblocks; ++s) {
+    if (s % superblocks_per_region == 0) {
+      regions_[s / superblocks_per_region] = ones;
+    }
+    std::uint64_t entry = (ones - regions_[s / superblocks_per_region]) << 32;
+    for (size_type b = 0; b < superblock_bits / block_bits; ++b) {
+      const size_type w_first = std::min(words, (s * superblock_bits + b * block_bits) / digits);
+      const size_type w_last = std::min(words, w_first + block_bits / digits);
+      std::uint64_t block_ones = 0;
+      for (size_type w = w_first; w < w_last; ++w) {
+        block_ones += std::popcount(word(w));
+      }
+      if (b < 3) {
+        entry |= block_ones << (20 - 10 * b);
+      }
+      ones += block_ones;
+    }
+    superblocks_[s] = entry;
+  }
+  ones_ = ones;
+
+  for (bit_value value : {bit0, bit1}) {
+    auto& samples = samples_[static_cast<bool>(value)];
+    const size_type total = count(value);
+    size_type next = 0;
+    for (size_type s = 0; s < superblocks && next < total; ++s) {
+      const size_type end_rank = (s + 1 < superblocks) ? superblock_rank(s + 1, value) : total;
+      for (; next < end_rank; next += select_sample) {
+        samples.push_back(s);
+      }
+    }
+  }
+}
+
+// Reads the i-th word of the range, with any bits past the end cleared
+template <typename RandomAccessIt>
+constexpr typename rank_select<RandomAccessIt>::uword_type
+rank_select<RandomAccessIt>::word(size_type i) const {
+  const size_type len = std::min(digits, size_ - i * digits);
+  uword_type w;
+  if (first_.position() == 0) {
+    w = static_cast<uword_type>(*std::next(first_.base(), i));
+  } else {
+    w = static_cast<uword_type>(get_word<word_type>(first_ + i * digits, len));
+  }
+  if (len < digits) {
+    w &= _mask<uword_type>(len);
+  }
+  return w;
+}
+
+template <typename RandomAccessIt>
+constexpr typename rank_select<RandomAccessIt>::size_type
+rank_select<RandomAccessIt>::superblock_rank(size_type s, bit_value value) const {
+  const size_type ones = regions_[s / superblocks_per_region] + (superblocks_[s] >> 32);
+  return (value == bit1) ? ones : s * superblock_bits - ones;
+}
+
+template <typename RandomAccessIt>
+constexpr typename rank_select<RandomAccessIt>::size_type
+rank_select<RandomAccessIt>::block_count(size_type s, size_type b) const {
+  return (superblocks_[s] >> (20 - 10 * b)) & 0x3FF;
+}
+
+template <typename RandomAccessIt>
+constexpr typename rank_select<RandomAccessIt>::size_type
+rank_select<RandomAccessIt>::rank(size_type pos, bit_value value) const {
+  assert(pos <= size_);
+  const size_type s = pos / superblock_bits;
+  const size_type b = (pos % superblock_bits) / block_bits;
+  size_type ones = superblock_rank(s, bit1);
+  for (size_type i = 0; i < b; ++i) {
+    ones += block_count(s, i);
+  }
+  const size_type w_last = pos / digits;
+  for (size_type w = (s * superblock_bits + b * block_bits) / digits; w < w_last; ++w) {
+    ones += std::popcount(word(w));
+  }
+  if (pos % digits) {
+    ones += std::popcount(static_cast<uword_type>(word(w_last) & _mask<uword_type>(pos % digits)));
+  }
+  return (value == bit1) ? ones : pos - ones;
+}
+
+template <typename RandomAccessIt>
+constexpr typename rank_select<RandomAccessIt>::size_type
+rank_select<RandomAccessIt>::select(size_type k, bit_value value) const {
+  if (k >= count(value)) {
+    return size_;
+  }
+
+  // The sampled superblocks bracket the answer
+  const auto& samples = samples_[static_cast<bool>(value)];
+  const size_type sample = k / select_sample;
+  size_type lo = samples[sample];
+  size_type hi = (sample + 1 < samples.size()) ? samples[sample + 1] + 1 : superblocks_.size();
+  while (hi - lo > 1) {
+    const size_type mid = lo + (hi - lo) / 2;
+    if (superblock_rank(mid, value) <= k) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  k -= superblock_rank(lo, value);
+
+  size_type pos = lo * superblock_bits;
+  for (size_type b = 0; b < 3 && pos + block_bits < size_; ++b) {
+    const size_type ones = block_count(lo, b);
+    const size_type c = (value == bit1) ? ones : block_bits - ones;
+    if (k < c) {
+      break;
+    }
+    k -= c;
+    pos += block_bits;
+  }
+
+  for (size_type w = pos / digits;; ++w) {
+    uword_type bits = word(w);
+    if (value == bit0) {
+      bits = static_cast<uword_type>(~bits);
+      const size_type len = std::min(digits, size_ - w * digits);
+      if (len < digits) {
+        bits &= _mask<uword_type>(len);
+      }
+    }
+    const size_type c = std::popcount(bits);
+    if (k < c) {
+      return w * digits + detail::select_in_word(bits, k);
+    }
+    k -= c;
+  }
+}
+
+}  // namespace bit
+
+#endif  // _BIT_RANK_SELECT_HPP_INCLUDED
@@ -0,0 +1,788 @@
+// ============================= ROARING BITMAP ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_roaring_bitmap.hpp
+// Description: Compressed bitmap of array, bitmap and run containers
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_ROARING_BITMAP_HPP_INCLUDED
+#define _BIT_ROARING_BITMAP_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+namespace detail {
+
+struct bit_andnot {
+  template <typename T>
+  constexpr T operator()(T a, T b) const noexcept {
+    return a & ~b;
+  }
+};
+
+/**
+ * @brief The members of one 2^16 bit chunk of a roaring_bitmap
+ *
+ * Stored as whichever is smallest of a sorted array of the members (up to
+ * 4096 of them), a plain 1024 word bitmap, or a list of runs.
+ */
+struct roaring_container {
+  static constexpr std::uint32_t chunk_bits = std::uint32_t{1} << 16;
+  static constexpr std::size_t chunk_words = chunk_bits / 64;
+  static constexpr std::uint32_t array_max = 4096;
+
+  enum class kind : std::uint8_t { array, bitmap, run };
+  using words_type = std::array<std::uint64_t, chunk_words>;
+
+  kind type = kind::array;
+  std::uint32_t cardinality = 0;
+  // array: sorted members, run: (start, length - 1) pairs
+  std::vector<std::uint16_t> values;
+  // bitmap: chunk_words words
+  std::vector<std::uint64_t> words;
+
+  // First position >= low of a bit equal to value in a chunk of words, or chunk_bits
+  static std::uint32_t next_in(const std::uint64_t* in, std::uint32_t low, bit_value value) {
+    if (low >= chunk_bits) {
+      return chunk_bits;
+    }
+    const std::uint64_t flip = (value == bit1) ? 0 : ~std::uint64_t{0};
+    std::size_t w = low / 64;
+    std::uint64_t bits = (in[w] ^ flip) & (~std::uint64_t{0} << (low % 64));
+    while (!bits) {
+      if (++w == chunk_words) {
+        return chunk_bits;
+      }
+      bits = in[w] ^ flip;
+    }
+    return static_cast<std::uint32_t>(w * 64 + std::countr_zero(bits));
+  }
+
+  // Number of runs starting at or before low
+  std::size_t runs_before(std::uint32_t low) const {
+    std::size_t first = 0;
+    std::size_t count = values.size() / 2;
+    while (count) {
+      const std::size_t half = count / 2;
+      if (values[2 * (first + half)] <= low) {
+        first += half + 1;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+    return first;
+  }
+
+  bool contains(std::uint16_t low) const {
+    switch (type) {
+      case kind::array:
+        return std::binary_search(values.begin(), values.end(), low);
+      case kind::bitmap:
+        return (words[low / 64] >> (low % 64)) & 1;
+      case kind::run:
+      default: {
+        const std::size_t r = runs_before(low);
+        return r && low <= values[2 * r - 2] + values[2 * r - 1];
+      }
+    }
+  }
+
+  // First member >= low, or chunk_bits if there is none
+  std::uint32_t next(std::uint32_t low) const {
+    if (low >= chunk_bits) {
+      return chunk_bits;
+    }
+    switch (type) {
+      case kind::array: {
+        const auto it = std::lower_bound(values.begin(), values.end(), low);
+        return (it == values.end()) ? chunk_bits : *it;
+      }
+      case kind::bitmap:
+        return next_in(words.data(), low, bit1);
+      case kind::run:
+      default: {
+        const std::size_t r = runs_before(low);
+        if (r && low <= std::uint32_t{values[2 * r - 2]} + values[2 * r - 1]) {
+          return low;
+        }
+        return (2 * r < values.size()) ? values[2 * r] : chunk_bits;
+      }
+    }
+  }
+
+  // First non-member, or chunk_bits if the chunk is full
+  std::uint32_t first_zero() const {
+    switch (type) {
+      case kind::array: {
+        // values[i] == i exactly for the members below the first gap
+        std::size_t first = 0;
+        std::size_t count = values.size();
+        while (count) {
+          const std::size_t half = count / 2;
+          if (values[first + half] == first + half) {
+            first += half + 1;
+            count -= half + 1;
+          } else {
+            count = half;
+          }
+        }
+        return static_cast<std::uint32_t>(first);
+      }
+      case kind::bitmap:
+        return next_in(words.data(), 0, bit0);
+      case kind::run:
+      default:
+        return (values.empty() || values[0] != 0) ? 0 : std::uint32_t{values[1]} + 1;
+    }
+  }
+
+  void to_words(words_type& out) const {
+    switch (type) {
+      case kind::array:
+        out.fill(0);
+        for (std::uint16_t v : values) {
+          out[v / 64] |= std::uint64_t{1} << (v % 64);
+        }
+        break;
+      case kind::bitmap:
+        std::copy(words.begin(), words.end(), out.begin());
+        break;
+      case kind::run:
+        out.fill(0);
+        for (std::size_t i = 0; i < values.size(); i += 2) {
+          ::bit::fill(bit_iterator<std::uint64_t*>(out.data()) + values[i],
+                      bit_iterator<std::uint64_t*>(out.data()) + values[i] + values[i + 1] + 1,
+                      bit1);
+        }
+        break;
+    }
+  }
+
+  // Builds the smallest representation of the given chunk
+  static roaring_container from_words(const words_type& in) {
+    roaring_container result;
+    std::uint32_t runs = 0;
+    std::uint64_t carry = 0;
+    for (std::uint64_t w : in) {
+      result.cardinality += std::popcount(w);
+      runs += std::popcount(w & ~((w << 1) | carry));
+      carry = w >> 63;
+    }
+
+    const std::size_t array_bytes = 2 * std::size_t{result.cardinality};
+    const std::size_t bitmap_bytes = 8 * chunk_words;
+    const std::size_t run_bytes = 4 * std::size_t{runs};
+    if (run_bytes < std::min(array_bytes, bitmap_bytes)) {
+      result.type = kind::run;
+      result.values.reserve(2 * runs);
+      for (std::uint32_t start = next_in(in.data(), 0, bit1); start < chunk_bits;) {
+        const std::uint32_t end = next_in(in.data(), start, bit0);
+        result.values.push_back(static_cast<std::uint16_t>(start));
+        result.values.push_back(static_cast<std::uint16_t>(end - start - 1));
+        start = next_in(in.data(), end, bit1);
+      }
+    } else if (result.cardinality <= array_max) {
+      result.type = kind::array;
+      result.values.reserve(result.cardinality);
+      for (std::size_t w = 0; w < chunk_words; ++w) {
+        for (std::uint64_t bits = in[w]; bits; bits &= bits - 1) {
+          result.values.push_back(static_cast<std::uint16_t>(w * 64 + std::countr_zero(bits)));
+        }
+      }
+    } else {
+      result.type = kind::bitmap;
+      result.words.assign(in.begin(), in.end());
+    }
+    return result;
+  }
+
+  static roaring_container from_array(std::vector<std::uint16_t> members) {
+    roaring_container result;
+    result.cardinality = static_cast<std::uint32_t>(members.size());
+    if (result.cardinality <= array_max) {
+      result.values = std::move(members);
+      return result;
+    }
+    words_type w{};
+    for (std::uint16_t v : members) {
+      w[v / 64] |= std::uint64_t{1} << (v % 64);
+    }
+    return from_words(w);
+  }
+
+  // Adds or removes low, keeping the representation within its limits
+  void set(std::uint16_t low, bool value) {
+    if (contains(low) == value) {
+      return;
+    }
+    switch (type) {
+      case kind::array:
+        if (!value || cardinality < array_max) {
+          const auto it = std::lower_bound(values.begin(), values.end(), low);
+          if (value) {
+            values.insert(it, low);
+            ++cardinality;
+          } else {
+            values.erase(it);
+            --cardinality;
+          }
+          return;
+        }
+        break;
+      case kind::bitmap:
+        words[low / 64] ^= std::uint64_t{1} << (low % 64);
+        value ? ++cardinality : --cardinality;
+        if (cardinality > array_max) {
+          return;
+        }
+        break;
+      case kind::run:
+      default:
+        set_run(low, value);
+        value ? ++cardinality : --cardinality;
+        // Fall back to an array or bitmap once runs stop being the smallest
+        if (2 * values.size() <= std::min<std::size_t>(2 * std::size_t{cardinality}, 8 * chunk_words)) {
+          return;
+        }
+        break;
+    }
+    words_type w;
+    to_words(w);
+    if (type == kind::array) {
+      w[low / 64] |= std::uint64_t{1} << (low % 64);
+    }
+    *this = from_words(w);
+  }
+
+  // Adds or removes low, which is not or is a member, in a run container
+  void set_run(std::uint16_t low, bool value) {
+    const std::size_t r = runs_before(low);
+    const auto at = values.begin() + 2 * r;
+    if (value) {
+      const bool joins_prev = r && std::uint32_t{values[2 * r - 2]} + values[2 * r - 1] + 1 == low;
+      const bool joins_next = 2 * r < values.size() && values[2 * r] == low + 1;
+      if (joins_prev && joins_next) {
+        values[2 * r - 1] = static_cast<std::uint16_t>(values[2 * r - 1] + values[2 * r + 1] + 2);
+        values.erase(at, at + 2);
+      } else if (joins_prev) {
+        ++values[2 * r - 1];
+      } else if (joins_next) {
+        --values[2 * r];
+        ++values[2 * r + 1];
+      } else {
+        values.insert(at, {low, 0});
+      }
+      return;
+    }
+    // low is inside run r - 1
+    const std::uint16_t start = values[2 * r - 2];
+    const std::uint16_t last = static_cast<std::uint16_t>(start + values[2 * r - 1]);
+    if (start == last) {
+      values.erase(at - 2, at);
+    } else if (low == start) {
+      ++values[2 * r - 2];
+      --values[2 * r - 1];
+    } else if (low == last) {
+      --values[2 * r - 1];
+    } else {
+      values[2 * r - 1] = static_cast<std::uint16_t>(low - start - 1);
+      values.insert(at, {static_cast<std::uint16_t>(low + 1), static_cast<std::uint16_t>(last - low - 1)});
+    }
+  }
+
+  std::size_t bytes() const {
+    return sizeof(roaring_container) + values.capacity() * sizeof(std::uint16_t) +
+           words.capacity() * sizeof(std::uint64_t);
+  }
+
+  template <typename Op>
+  static roaring_container combine(const roaring_container& a, const roaring_container& b, Op op) {
+    if (a.type == kind::array && b.type == kind::array) {
+      std::vector<std::uint16_t> members;
+      auto out = std::back_inserter(members);
+      if constexpr (std::is_same_v<Op, std::bit_and<>>) {
+        std::set_intersection(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), out);
+      } else if constexpr (std::is_same_v<Op, std::bit_or<>>) {
+        std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), out);
+      } else if constexpr (std::is_same_v<Op, std::bit_xor<>>) {
+        std::set_symmetric_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), out);
+      } else {
+        std::set_difference(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(), out);
+      }
+      return from_array(std::move(members));
+    }
+    if constexpr (std::is_same_v<Op, std::bit_and<>> || std::is_same_v<Op, bit_andnot>) {
+      // Only the members of a can survive, so test them one at a time
+      if (a.type == kind::array) {
+        std::vector<std::uint16_t> members;
+        for (std::uint16_t v : a.values) {
+          if (b.contains(v) == std::is_same_v<Op, std::bit_and<>>) {
+            members.push_back(v);
+          }
+        }
+        return from_array(std::move(members));
+      }
+    }
+    words_type wa;
+    words_type wb;
+    a.to_words(wa);
+    b.to_words(wb);
+    for (std::size_t i = 0; i < chunk_words; ++i) {
+      wa[i] = op(wa[i], wb[i]);
+    }
+    return from_words(wa);
+  }
+
+};
+
+}  // namespace detail
+
+/**
+ * @brief A compressed bitmap of a fixed number of bits
+ *
+ * Roaring layout: the bits are split into 2^16 bit chunks and only chunks
+ * with members are stored, each as a sorted array, a plain bitmap or a run
+ * list, whichever is smallest. Sparse and clustered sets take a fraction of
+ * the memory of a bit_vector, and cardinality, union, intersection and
+ * difference work a chunk at a time.
+ *
+ * Iteration visits the positions of the set bits in increasing order, and
+ * bits() is a random access view of all size() bits as bit values.
+ * Conversion to and from any bit range (bit_vector, bit_span, bit_array,
+ * ...) is a word-wise copy.
+ */
+class roaring_bitmap {
+ public:
+  using size_type = std::size_t;
+  using value_type = std::uint32_t;
+
+ private:
+  using container = detail::roaring_container;
+  static constexpr size_type chunk_bits = container::chunk_bits;
+
+  size_type size_ = 0;
+  std::vector<std::uint16_t> keys_;
+  std::vector<container> containers_;
+
+  size_type index_of(std::uint16_t key) const {
+    return static_cast<size_type>(std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin());
+  }
+
+  template <typename Op>
+  roaring_bitmap merge(const roaring_bitmap& other, Op op, bool keep_left, bool keep_right) const {
+    roaring_bitmap result(std::max(size_, other.size_));
+    size_type i = 0;
+    size_type j = 0;
+    while (i < keys_.size() || j < other.keys_.size()) {
+      const bool has_left = i < keys_.size();
+      const bool has_right = j < other.keys_.size();
+      if (has_left && (!has_right || keys_[i] < other.keys_[j])) {
+        if (keep_left) {
+          result.keys_.push_back(keys_[i]);
+          result.containers_.push_back(containers_[i]);
+        }
+        ++i;
+      } else if (has_right && (!has_left || other.keys_[j] < keys_[i])) {
+        if (keep_right) {
+          result.keys_.push_back(other.keys_[j]);
+          result.containers_.push_back(other.containers_[j]);
+        }
+        ++j;
+      } else {
+        container combined = container::combine(containers_[i], other.containers_[j], op);
+        if (combined.cardinality) {
+          result.keys_.push_back(keys_[i]);
+          result.containers_.push_back(std::move(combined));
+        }
+        ++i;
+        ++j;
+      }
+    }
+    return result;
+  }
+
+ public:
+  class const_iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::uint32_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::uint32_t;
+
+   private:
+    const roaring_bitmap* bitmap_ = nullptr;
+    size_type index_ = 0;
+    std::uint32_t low_ = 0;
+
+    void settle() {
+      while (index_ < bitmap_->keys_.size()) {
+        low_ = bitmap_->containers_[index_].next(low_);
+        if (low_ < chunk_bits) {
+          return;
+        }
+        ++index_;
+        low_ = 0;
+      }
+    }
+
+   public:
+    const_iterator() = default;
+    const_iterator(const roaring_bitmap* bitmap, size_type index) : bitmap_(bitmap), index_(index) {
+      settle();
+    }
+
+    reference operator*() const {
+      return (std::uint32_t{bitmap_->keys_[index_]} << 16) | low_;
+    }
+
+    const_iterator& operator++() {
+      ++low_;
+      settle();
+      return *this;
+    }
+
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) {
+      return lhs.index_ == rhs.index_ && lhs.low_ == rhs.low_;
+    }
+  };
+  using iterator = const_iterator;
+
+  /**
+   * @brief Random access iterator over every bit, yielding bit values
+   */
+  class const_bit_iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = bit_value;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = bit_value;
+    using size_type = std::size_t;
+
+   private:
+    const roaring_bitmap* bitmap_ = nullptr;
+    size_type position_ = 0;
+
+   public:
+    const_bit_iterator() = default;
+    const_bit_iterator(const roaring_bitmap* bitmap, size_type position) : bitmap_(bitmap), position_(position) {}
+
+    size_type position() const noexcept {
+      return position_;
+    }
+
+    reference operator*() const {
+      return bitmap_->test(position_);
+    }
+
+    reference operator[](difference_type n) const {
+      return *(*this + n);
+    }
+
+    const_bit_iterator& operator++() {
+      ++position_;
+      return *this;
+    }
+
+    const_bit_iterator operator++(int) {
+      const_bit_iterator old = *this;
+      ++position_;
+      return old;
+    }
+
+    const_bit_iterator& operator--() {
+      --position_;
+      return *this;
+    }
+
+    const_bit_iterator operator--(int) {
+      const_bit_iterator old = *this;
+      --position_;
+      return old;
+    }
+
+    const_bit_iterator& operator+=(difference_type n) {
+      position_ += n;
+      return *this;
+    }
+
+    const_bit_iterator& operator-=(difference_type n) {
+      position_ -= n;
+      return *this;
+    }
+
+    friend const_bit_iterator operator+(const_bit_iterator it, difference_type n) {
+      return it += n;
+    }
+
+    friend const_bit_iterator operator+(difference_type n, const_bit_iterator it) {
+      return it += n;
+    }
+
+    friend const_bit_iterator operator-(const_bit_iterator it, difference_type n) {
+      return it -= n;
+    }
+
+    friend difference_type operator-(const const_bit_iterator& lhs, const const_bit_iterator& rhs) {
+      return static_cast<difference_type>(lhs.position_) - static_cast<difference_type>(rhs.position_);
+    }
+
+    friend bool operator==(const const_bit_iterator& lhs, const const_bit_iterator& rhs) {
+      return lhs.position_ == rhs.position_;
+    }
+
+    friend auto operator<=>(const const_bit_iterator& lhs, const const_bit_iterator& rhs) {
+      return lhs.position_ <=> rhs.position_;
+    }
+  };
+
+  /**
+   * @brief The size() bits of a roaring_bitmap as a sized range of bit values
+   */
+  class bit_view {
+   public:
+    using value_type = bit_value;
+    using size_type = std::size_t;
+    using iterator = const_bit_iterator;
+    using const_iterator = const_bit_iterator;
+
+   private:
+    const roaring_bitmap* bitmap_ = nullptr;
+
+   public:
+    bit_view() = default;
+    explicit bit_view(const roaring_bitmap* bitmap) : bitmap_(bitmap) {}
+
+    size_type size() const noexcept {
+      return bitmap_->size();
+    }
+
+    const_bit_iterator begin() const noexcept {
+      return const_bit_iterator(bitmap_, 0);
+    }
+
+    const_bit_iterator end() const noexcept {
+      return const_bit_iterator(bitmap_, size());
+    }
+
+    bit_value operator[](size_type pos) const {
+      return bitmap_->test(pos);
+    }
+  };
+
+  roaring_bitmap() = default;
+
+  /**
+   * @brief An empty bitmap of size bits
+   */
+  explicit roaring_bitmap(size_type size) : size_(size) {
+    assert(size <= (size_type{1} << 32));
+  }
+
+  /**
+   * @brief Compresses a bit range such as bit_vector, bit_span or bit_array
+   */
+  template <bit_sized_range Range>
+  explicit roaring_bitmap(const Range& bits) : roaring_bitmap(std::ranges::size(bits)) {
+    using chunk_iterator = bit_iterator<std::uint64_t*>;
+    container::words_type words;
+    auto first = std::ranges::begin(bits);
+    for (size_type key = 0; key * chunk_bits < size_; ++key) {
+      const size_type len = std::min<size_type>(chunk_bits, size_ - key * chunk_bits);
+      words.fill(0);
+      ::bit::copy(first + key * chunk_bits, first + key * chunk_bits + len, chunk_iterator(words.data()));
+      if (std::any_of(words.begin(), words.end(), [](std::uint64_t w) { return w != 0; })) {
+        keys_.push_back(static_cast<std::uint16_t>(key));
+        containers_.push_back(container::from_words(words));
+      }
+    }
+  }
+
+  size_type size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return keys_.empty();
+  }
+
+  const_iterator begin() const {
+    return const_iterator(this, 0);
+  }
+
+  const_iterator end() const {
+    return const_iterator(this, keys_.size());
+  }
+
+  bit_view bits() const noexcept {
+    return bit_view(this);
+  }
+
+  bit_value test(size_type pos) const {
+    assert(pos < size_);
+    const std::uint16_t key = static_cast<std::uint16_t>(pos >> 16);
+    const size_type i = index_of(key);
+    return (i < keys_.size() && keys_[i] == key && containers_[i].contains(static_cast<std::uint16_t>(pos))) ? bit1 : bit0;
+  }
+
+  bit_value operator[](size_type pos) const {
+    return test(pos);
+  }
+
+  void set(size_type pos, bit_value value = bit1) {
+    assert(pos < size_);
+    const std::uint16_t key = static_cast<std::uint16_t>(pos >> 16);
+    const size_type i = index_of(key);
+    if (i == keys_.size() || keys_[i] != key) {
+      if (value == bit0) {
+        return;
+      }
+      keys_.insert(keys_.begin() + i, key);
+      containers_.insert(containers_.begin() + i, container{});
+    }
+    containers_[i].set(static_cast<std::uint16_t>(pos), value == bit1);
+    if (containers_[i].cardinality == 0) {
+      keys_.erase(keys_.begin() + i);
+      containers_.erase(containers_.begin() + i);
+    }
+  }
+
+  void reset(size_type pos) {
+    set(pos, bit0);
+  }
+
+  /**
+   * @brief Number of bits equal to value
+   */
+  size_type count(bit_value value = bit1) const noexcept {
+    size_type ones = 0;
+    for (const container& c : containers_) {
+      ones += c.cardinality;
+    }
+    return (value == bit1) ? ones : size_ - ones;
+  }
+
+  /**
+   * @brief Position of the first bit equal to value, or size() if none
+   */
+  size_type find(bit_value value = bit1) const {
+    if (value == bit1) {
+      return empty() ? size_ : *begin();
+    }
+    // The first zero is in the first chunk that is missing or not full
+    size_type key = 0;
+    for (size_type i = 0; i < keys_.size() && keys_[i] == key; ++i, ++key) {
+      const std::uint32_t low = containers_[i].first_zero();
+      if (low < chunk_bits) {
+        return std::min(key * chunk_bits + low, size_);
+      }
+    }
+    return std::min(key * chunk_bits, size_);
+  }
+
+  /**
+   * @brief Approximate heap and object memory used, in bytes
+   */
+  size_type memory_usage() const noexcept {
+    size_type bytes = sizeof(roaring_bitmap) + keys_.capacity() * sizeof(std::uint16_t);
+    for (const container& c : containers_) {
+      bytes += c.bytes();
+    }
+    return bytes + (containers_.capacity() - containers_.size()) * sizeof(container);
+  }
+
+  /**
+   * @brief Decompresses into the size() bits starting at d_first
+   */
+  template <typename RandomAccessIt>
+  bit_iterator<RandomAccessIt> copy_to(bit_iterator<RandomAccessIt> d_first) const {
+    using chunk_iterator = bit_iterator<const std::uint64_t*>;
+    ::bit::fill(d_first, d_first + size_, bit0);
+    container::words_type words;
+    for (size_type i = 0; i < keys_.size(); ++i) {
+      const size_type offset = size_type{keys_[i]} * chunk_bits;
+      const size_type len = std::min<size_type>(chunk_bits, size_ - offset);
+      containers_[i].to_words(words);
+      ::bit::copy(chunk_iterator(words.data()), chunk_iterator(words.data()) + len, d_first + offset);
+    }
+    return d_first + size_;
+  }
+
+  template <typename WordType = std::uint64_t>
+  bit_vector<WordType> to_bit_vector() const {
+    bit_vector<WordType> result(size_);
+    copy_to(result.begin());
+    return result;
+  }
+
+  friend roaring_bitmap operator|(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+    return lhs.merge(rhs, std::bit_or<>{}, true, true);
+  }
+
+  friend roaring_bitmap operator&(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+    return lhs.merge(rhs, std::bit_and<>{}, false, false);
+  }
+
+  friend roaring_bitmap operator^(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+    return lhs.merge(rhs, std::bit_xor<>{}, true, true);
+  }
+
+  /**
+   * @brief Difference: the bits of lhs which are not set in rhs
+   */
+  friend roaring_bitmap operator-(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+    roaring_bitmap result = lhs.merge(rhs, detail::bit_andnot{}, true, false);
+    result.size_ = lhs.size_;
+    return result;
+  }
+
+  roaring_bitmap& operator|=(const roaring_bitmap& other) {
+    return *this = *this | other;
+  }
+
+  roaring_bitmap& operator&=(const roaring_bitmap& other) {
+    return *this = *this & other;
+  }
+
+  roaring_bitmap& operator^=(const roaring_bitmap& other) {
+    return *this = *this ^ other;
+  }
+
+  roaring_bitmap& operator-=(const roaring_bitmap& other) {
+    return *this = *this - other;
+  }
+
+  friend bool operator==(const roaring_bitmap& lhs, const roaring_bitmap& rhs) {
+    return lhs.size_ == rhs.size_ && lhs.count() == rhs.count() &&
+           std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+};
+
+}  // namespace bit
+
+#endif  // _BIT_ROARING_BITMAP_HPP_INCLUDED
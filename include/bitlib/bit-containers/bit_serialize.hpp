@@ -0,0 +1,475 @@
+// ============================== SERIALIZE ================================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_serialize.hpp
+// Description: Portable binary serialization of bit ranges
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_SERIALIZE_HPP_INCLUDED
+#define _BIT_SERIALIZE_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <system_error>
+#endif
+
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit_concepts.hpp"
+
+namespace bit {
+
+/*
+ * Stream layout, all header and trailer fields little endian:
+ *
+ *   offset  size  field
+ *        0     4  magic "BITL"
+ *        4     2  version
+ *        6     1  word size in bytes (1, 2, 4 or 8)
+ *        7     1  flags, bit 0 set if the payload words are big endian
+ *        8     8  length in bits
+ *       16     *  payload: ceil(length / word bits) words, unused high
+ *                 bits of the last word zero
+ *        *     8  checksum of the payload bytes
+ *
+ * The checksum trails the payload so a writer can stream in one pass
+ * without buffering the whole range.
+ */
+namespace serial {
+
+constexpr std::array<std::byte, 4> magic = {std::byte{'B'}, std::byte{'I'}, std::byte{'T'}, std::byte{'L'}};
+constexpr std::uint16_t version = 1;
+constexpr std::size_t header_bytes = 16;
+constexpr std::size_t trailer_bytes = 8;
+constexpr std::size_t default_chunk_bytes = std::size_t{1} << 16;
+// What a source's optional remaining() returns when it cannot tell
+constexpr std::uint64_t unknown_length = ~std::uint64_t{0};
+
+struct header {
+  std::uint16_t version;
+  std::uint8_t word_bytes;
+  std::endian endian;
+  std::uint64_t size;
+};
+
+/**
+ * @brief Sink writing to a std::ostream
+ */
+class stream_sink {
+  std::ostream& os_;
+
+ public:
+  explicit stream_sink(std::ostream& os) : os_(os) {}
+  void operator()(const std::byte* data, std::size_t n) const {
+    os_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(n));
+    if (!os_) {
+      throw std::runtime_error("bit::serial: stream write failed");
+    }
+  }
+};
+
+/**
+ * @brief Source reading from a std::istream
+ */
+class stream_source {
+  std::istream& is_;
+
+ public:
+  explicit stream_source(std::istream& is) : is_(is) {}
+  void operator()(std::byte* data, std::size_t n) const {
+    is_.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(n));
+    if (static_cast<std::size_t>(is_.gcount()) != n) {
+      throw std::runtime_error("bit::serial: unexpected end of stream");
+    }
+  }
+
+  // Bytes left in a seekable stream, or unknown_length
+  std::uint64_t remaining() const {
+    const std::istream::pos_type here = is_.tellg();
+    if (here == std::istream::pos_type(-1)) {
+      return unknown_length;
+    }
+    is_.seekg(0, std::ios_base::end);
+    const std::istream::pos_type end = is_.tellg();
+    is_.clear();
+    is_.seekg(here);
+    if (end == std::istream::pos_type(-1) || end < here) {
+      return unknown_length;
+    }
+    return static_cast<std::uint64_t>(end - here);
+  }
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * @brief Sink writing to a file descriptor
+ */
+class fd_sink {
+  int fd_;
+
+ public:
+  explicit fd_sink(int fd) : fd_(fd) {}
+  void operator()(const std::byte* data, std::size_t n) const {
+    while (n) {
+      const ::ssize_t written = ::write(fd_, data, n);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::system_error(errno, std::generic_category(), "bit::serial: write");
+      }
+      data += written;
+      n -= static_cast<std::size_t>(written);
+    }
+  }
+};
+
+/**
+ * @brief Source reading from a file descriptor
+ */
+class fd_source {
+  int fd_;
+
+ public:
+  explicit fd_source(int fd) : fd_(fd) {}
+  void operator()(std::byte* data, std::size_t n) const {
+    while (n) {
+      const ::ssize_t got = ::read(fd_, data, n);
+      if (got < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::system_error(errno, std::generic_category(), "bit::serial: read");
+      }
+      if (got == 0) {
+        throw std::runtime_error("bit::serial: unexpected end of file");
+      }
+      data += got;
+      n -= static_cast<std::size_t>(got);
+    }
+  }
+
+  // Bytes left in a regular file, or unknown_length for pipes and sockets
+  std::uint64_t remaining() const {
+    struct stat st;
+    if (::fstat(fd_, &st) == -1 || !S_ISREG(st.st_mode)) {
+      return unknown_length;
+    }
+    const ::off_t here = ::lseek(fd_, 0, SEEK_CUR);
+    if (here == -1 || here > st.st_size) {
+      return unknown_length;
+    }
+    return static_cast<std::uint64_t>(st.st_size - here);
+  }
+};
+#endif
+
+}  // namespace serial
+
+namespace detail {
+
+// Word-at-a-time hash of a byte stream, independent of how it is chunked
+class serial_checksum {
+  std::uint64_t hash_ = 0x243F6A8885A308D3ull;
+  std::uint64_t lane_ = 0;
+  std::size_t filled_ = 0;
+  std::uint64_t bytes_ = 0;
+
+  static constexpr std::uint64_t mix(std::uint64_t hash, std::uint64_t value) noexcept {
+    return std::rotl(hash ^ value, 31) * 0x9E3779B97F4A7C15ull;
+  }
+
+  void push(std::byte b) noexcept {
+    lane_ |= std::uint64_t{std::to_integer<std::uint8_t>(b)} << (8 * filled_);
+    if (++filled_ == 8) {
+      hash_ = mix(hash_, lane_);
+      lane_ = 0;
+      filled_ = 0;
+    }
+  }
+
+ public:
+  void update(const std::byte* data, std::size_t n) noexcept {
+    bytes_ += n;
+    std::size_t i = 0;
+    for (; i < n && filled_ != 0; ++i) {
+      push(data[i]);
+    }
+    for (; i + 8 <= n; i += 8) {
+      std::uint64_t lane;
+      std::memcpy(&lane, data + i, 8);
+      if constexpr (std::endian::native == std::endian::big) {
+        lane = std::byteswap(lane);
+      }
+      hash_ = mix(hash_, lane);
+    }
+    for (; i < n; ++i) {
+      push(data[i]);
+    }
+  }
+
+  std::uint64_t value() const noexcept {
+    const std::uint64_t hash = filled_ ? mix(hash_, lane_) : hash_;
+    return mix(hash, bytes_);
+  }
+};
+
+template <typename T>
+constexpr void store_le(std::byte* out, T value) noexcept {
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    out[i] = static_cast<std::byte>(static_cast<std::uint64_t>(value) >> (8 * i));
+  }
+}
+
+template <typename T>
+constexpr T load_le(const std::byte* in) noexcept {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value |= std::uint64_t{std::to_integer<std::uint8_t>(in[i])} << (8 * i);
+  }
+  return static_cast<T>(value);
+}
+
+template <typename Source>
+std::uint64_t source_remaining(const Source& source) {
+  if constexpr (requires { { source.remaining() } -> std::convertible_to<std::uint64_t>; }) {
+    return source.remaining();
+  } else {
+    return serial::unknown_length;
+  }
+}
+
+// Words holding size bits, without overflowing near 2^64
+constexpr std::uint64_t serial_word_count(std::uint64_t size, std::uint64_t digits) noexcept {
+  return size / digits + (size % digits != 0);
+}
+
+template <typename StoredWord, typename RandomAccessIt, typename Source>
+void read_payload_words(const serial::header& head, Source& source, bit_iterator<RandomAccessIt> d_first, std::size_t chunk_bytes) {
+  // Same sized words are read straight into the destination's type
+  using dst_word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+  using Word = std::conditional_t<sizeof(StoredWord) == sizeof(dst_word_type), dst_word_type, StoredWord>;
+  constexpr std::size_t digits = bitsof<Word>();
+  const std::size_t words = static_cast<std::size_t>(serial_word_count(head.size, digits));
+  const std::size_t chunk_words = std::max<std::size_t>(1, chunk_bytes / sizeof(Word));
+  std::vector<Word> buffer(std::min(chunk_words, words));
+  serial_checksum sum;
+  for (std::size_t w = 0; w < words;) {
+    const std::size_t n = std::min(chunk_words, words - w);
+    std::byte* bytes = reinterpret_cast<std::byte*>(buffer.data());
+    source(bytes, n * sizeof(Word));
+    sum.update(bytes, n * sizeof(Word));
+    if (head.endian != std::endian::native) {
+      std::transform(buffer.begin(), buffer.begin() + n, buffer.begin(), [](Word word) { return std::byteswap(word); });
+    }
+    const std::size_t len = std::min<std::size_t>(n * digits, head.size - w * digits);
+    ::bit::copy(bit_iterator<Word*>(buffer.data()), bit_iterator<Word*>(buffer.data()) + len, d_first + w * digits);
+    w += n;
+  }
+  std::array<std::byte, serial::trailer_bytes> trailer;
+  source(trailer.data(), trailer.size());
+  if (load_le<std::uint64_t>(trailer.data()) != sum.value()) {
+    throw std::runtime_error("bit::serial: checksum mismatch");
+  }
+}
+
+}  // namespace detail
+
+namespace serial {
+
+/**
+ * @brief Writes [first, last) to sink in chunks of about chunk_bytes
+ *
+ * The payload is the range's own words, copied straight from storage when
+ * the range is word aligned and endian matches the machine, otherwise
+ * realigned and byteswapped a word at a time.
+ *
+ * @param sink Callable as sink(const std::byte*, std::size_t)
+ * @param endian Byte order of the payload words
+ */
+template <typename RandomAccessIt, typename Sink>
+void write(bit_iterator<RandomAccessIt> first,
+           bit_iterator<RandomAccessIt> last,
+           Sink&& sink,
+           std::endian endian = std::endian::native,
+           std::size_t chunk_bytes = default_chunk_bytes) {
+  using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+  using uword_type = std::make_unsigned_t<word_type>;
+  constexpr std::size_t digits = bitsof<word_type>();
+  const std::size_t size = distance(first, last);
+
+  std::array<std::byte, header_bytes> head{};
+  std::copy(magic.begin(), magic.end(), head.begin());
+  detail::store_le<std::uint16_t>(&head[4], version);
+  head[6] = static_cast<std::byte>(sizeof(word_type));
+  head[7] = static_cast<std::byte>(endian == std::endian::big ? 1 : 0);
+  detail::store_le<std::uint64_t>(&head[8], size);
+  sink(head.data(), head.size());
+
+  const std::size_t words = (size + digits - 1) / digits;
+  const std::size_t chunk_words = std::max<std::size_t>(1, chunk_bytes / sizeof(word_type));
+  std::vector<uword_type> buffer;
+  detail::serial_checksum sum;
+  for (std::size_t w = 0; w < words;) {
+    const std::size_t n = std::min(chunk_words, words - w);
+    const std::byte* bytes;
+    if constexpr (std::contiguous_iterator<RandomAccessIt>) {
+      if (first.position() == 0 && endian == std::endian::native && (w + n) * digits <= size) {
+        bytes = reinterpret_cast<const std::byte*>(std::to_address(first.base() + w));
+        sum.update(bytes, n * sizeof(word_type));
+        sink(bytes, n * sizeof(word_type));
+        w += n;
+        continue;
+      }
+    }
+    buffer.resize(std::min(chunk_words, words));
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t pos = (w + i) * digits;
+      const std::size_t len = std::min(digits, size - pos);
+      uword_type word = (first.position() == 0)
+                            ? static_cast<uword_type>(*std::next(first.base(), w + i))
+                            : static_cast<uword_type>(get_word<word_type>(first + pos, len));
+      if (len < digits) {
+        word &= _mask<uword_type>(len);
+      }
+      buffer[i] = (endian == std::endian::native) ? word : std::byteswap(word);
+    }
+    bytes = reinterpret_cast<const std::byte*>(buffer.data());
+    sum.update(bytes, n * sizeof(word_type));
+    sink(bytes, n * sizeof(word_type));
+    w += n;
+  }
+
+  std::array<std::byte, trailer_bytes> trailer;
+  detail::store_le<std::uint64_t>(trailer.data(), sum.value());
+  sink(trailer.data(), trailer.size());
+}
+
+/**
+ * @brief Writes a bit range such as bit_vector, bit_span or bit_array
+ */
+template <bit_sized_range Range, typename Sink>
+void write(const Range& bits,
+           Sink&& sink,
+           std::endian endian = std::endian::native,
+           std::size_t chunk_bytes = default_chunk_bytes) {
+  write(std::ranges::begin(bits), std::ranges::end(bits), std::forward<Sink>(sink), endian, chunk_bytes);
+}
+
+/**
+ * @brief Reads and validates the header of a stream
+ *
+ * When the source can report the bytes it has left through remaining(), a
+ * length the rest of the stream cannot hold is rejected here, before
+ * anything is allocated for it.
+ *
+ * @param source Callable as source(std::byte*, std::size_t), filling exactly
+ *               that many bytes or throwing
+ */
+template <typename Source>
+header read_header(Source&& source) {
+  std::array<std::byte, header_bytes> head;
+  source(head.data(), head.size());
+  if (!std::equal(magic.begin(), magic.end(), head.begin())) {
+    throw std::runtime_error("bit::serial: not a bit stream");
+  }
+  header result;
+  result.version = detail::load_le<std::uint16_t>(&head[4]);
+  result.word_bytes = std::to_integer<std::uint8_t>(head[6]);
+  result.endian = (std::to_integer<std::uint8_t>(head[7]) & 1) ? std::endian::big : std::endian::little;
+  result.size = detail::load_le<std::uint64_t>(&head[8]);
+  if (result.version == 0 || result.version > version) {
+    throw std::runtime_error("bit::serial: unsupported version");
+  }
+  if (!std::has_single_bit(result.word_bytes) || result.word_bytes > 8) {
+    throw std::runtime_error("bit::serial: invalid word size");
+  }
+  const std::uint64_t payload = detail::serial_word_count(result.size, 8 * result.word_bytes) * result.word_bytes;
+  const std::uint64_t left = detail::source_remaining(source);
+  if (left != unknown_length && (left < trailer_bytes || payload > left - trailer_bytes)) {
+    throw std::runtime_error("bit::serial: length exceeds the stream");
+  }
+  return result;
+}
+
+/**
+ * @brief Reads the payload described by head into head.size bits at d_first
+ *
+ * The stored word size need not match the destination's. Throws on a
+ * checksum mismatch, after which the destination bits are unspecified.
+ */
+template <typename RandomAccessIt, typename Source>
+void read_payload(const header& head,
+                  Source&& source,
+                  bit_iterator<RandomAccessIt> d_first,
+                  std::size_t chunk_bytes = default_chunk_bytes) {
+  switch (head.word_bytes) {
+    case 1:
+      detail::read_payload_words<std::uint8_t>(head, source, d_first, chunk_bytes);
+      break;
+    case 2:
+      detail::read_payload_words<std::uint16_t>(head, source, d_first, chunk_bytes);
+      break;
+    case 4:
+      detail::read_payload_words<std::uint32_t>(head, source, d_first, chunk_bytes);
+      break;
+    default:
+      detail::read_payload_words<std::uint64_t>(head, source, d_first, chunk_bytes);
+      break;
+  }
+}
+
+/**
+ * @brief Reads a stream into an existing bit range of the same size
+ */
+template <typename Source, bit_sized_range Range>
+void read(Source&& source, Range&& bits, std::size_t chunk_bytes = default_chunk_bytes) {
+  const header head = read_header(source);
+  if (head.size != std::ranges::size(bits)) {
+    throw std::invalid_argument("bit::serial: stream length does not match the destination");
+  }
+  read_payload(head, source, std::ranges::begin(bits), chunk_bytes);
+}
+
+/**
+ * @brief Reads a stream into a new bit_vector
+ */
+template <typename WordType = std::uintptr_t, typename Source>
+bit_vector<WordType> read(Source&& source, std::size_t chunk_bytes = default_chunk_bytes) {
+  const header head = read_header(source);
+  // The length is untrusted; bound it before allocating
+  if (head.size > std::numeric_limits<std::size_t>::max() - bitsof<WordType>() ||
+      detail::serial_word_count(head.size, bitsof<WordType>()) >
+          static_cast<std::uint64_t>(std::numeric_limits<std::ptrdiff_t>::max()) / sizeof(WordType)) {
+    throw std::length_error("bit::serial: stream length is too large");
+  }
+  bit_vector<WordType> bits(static_cast<std::size_t>(head.size));
+  read_payload(head, source, bits.begin(), chunk_bytes);
+  return bits;
+}
+
+}  // namespace serial
+
+}  // namespace bit
+
+#endif  // _BIT_SERIALIZE_HPP_INCLUDED
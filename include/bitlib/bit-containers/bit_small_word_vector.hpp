@@ -0,0 +1,260 @@
+// ========================== BIT SMALL WORD VECTOR ========================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_small_word_vector.hpp
+// Description: Word storage with an inline buffer for bit_vector
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_SMALL_WORD_VECTOR_HPP_INCLUDED
+#define _BIT_SMALL_WORD_VECTOR_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace bit::detail {
+
+/**
+ * @brief The subset of std::vector<WordType> that bit_vector uses, keeping
+ *        up to InlineWords words inside the object
+ *
+ * Storage moves to the allocator only when the size grows past
+ * InlineWords, and moves back inline on shrink_to_fit once it fits again.
+ * Words are trivially copyable integers, so elements are copied rather
+ * than constructed.
+ */
+template <typename WordType, std::size_t InlineWords, typename Allocator = std::allocator<WordType>>
+class small_word_vector {
+  static_assert(InlineWords > 0);
+  static_assert(std::is_trivially_copyable_v<WordType>);
+
+ public:
+  using value_type = WordType;
+  using allocator_type = Allocator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = WordType&;
+  using const_reference = const WordType&;
+  using iterator = WordType*;
+  using const_iterator = const WordType*;
+
+ private:
+  using traits = std::allocator_traits<Allocator>;
+
+  WordType inline_[InlineWords] = {};
+  WordType* data_ = inline_;
+  size_type size_ = 0;
+  size_type capacity_ = InlineWords;
+  [[no_unique_address]] Allocator alloc_{};
+
+  constexpr bool is_inline() const noexcept {
+    return data_ == inline_;
+  }
+
+  constexpr void release() noexcept {
+    if (!is_inline()) {
+      traits::deallocate(alloc_, data_, capacity_);
+      data_ = inline_;
+      capacity_ = InlineWords;
+    }
+  }
+
+  // Moves the contents to a buffer of exactly new_cap words
+  constexpr void reallocate(size_type new_cap) {
+    WordType* buffer = (new_cap <= InlineWords) ? inline_ : traits::allocate(alloc_, new_cap);
+    if (buffer != data_) {
+      std::copy_n(data_, size_, buffer);
+      release();
+      data_ = buffer;
+      capacity_ = std::max(new_cap, InlineWords);
+    }
+  }
+
+  constexpr void grow_to(size_type count) {
+    if (count > capacity_) {
+      reallocate(std::max(count, 2 * capacity_));
+    }
+  }
+
+ public:
+  constexpr small_word_vector() noexcept(noexcept(Allocator())) = default;
+  constexpr explicit small_word_vector(const Allocator& alloc) noexcept : alloc_(alloc) {}
+  constexpr small_word_vector(size_type count, const Allocator& alloc = Allocator())
+      : small_word_vector(count, WordType{}, alloc) {}
+  constexpr small_word_vector(size_type count, const WordType& value, const Allocator& alloc = Allocator())
+      : alloc_(alloc) {
+    grow_to(count);
+    std::fill_n(data_, count, value);
+    size_ = count;
+  }
+  template <std::input_iterator It>
+  constexpr small_word_vector(It first, It last, const Allocator& alloc = Allocator())
+      : alloc_(alloc) {
+    for (; first != last; ++first) {
+      push_back(static_cast<WordType>(*first));
+    }
+  }
+  constexpr small_word_vector(std::initializer_list<WordType> init, const Allocator& alloc = Allocator())
+      : small_word_vector(init.begin(), init.end(), alloc) {}
+
+  constexpr small_word_vector(const small_word_vector& other, const Allocator& alloc)
+      : alloc_(alloc) {
+    grow_to(other.size_);
+    std::copy_n(other.data_, other.size_, data_);
+    size_ = other.size_;
+  }
+  constexpr small_word_vector(const small_word_vector& other)
+      : small_word_vector(other, traits::select_on_container_copy_construction(other.alloc_)) {}
+
+  constexpr small_word_vector(small_word_vector&& other, const Allocator& alloc)
+      : alloc_(alloc) {
+    if (!other.is_inline() && alloc_ == other.alloc_) {
+      data_ = std::exchange(other.data_, other.inline_);
+      capacity_ = std::exchange(other.capacity_, InlineWords);
+    } else {
+      grow_to(other.size_);
+      std::copy_n(other.data_, other.size_, data_);
+    }
+    size_ = std::exchange(other.size_, 0);
+  }
+  constexpr small_word_vector(small_word_vector&& other) noexcept
+      : small_word_vector(std::move(other), Allocator(other.alloc_)) {}
+
+  constexpr small_word_vector& operator=(const small_word_vector& other) {
+    if (this != &other) {
+      size_ = 0;
+      if constexpr (traits::propagate_on_container_copy_assignment::value) {
+        // A heap buffer must go back to the allocator that made it
+        if (alloc_ != other.alloc_) {
+          release();
+        }
+        alloc_ = other.alloc_;
+      }
+      grow_to(other.size_);
+      std::copy_n(other.data_, other.size_, data_);
+      size_ = other.size_;
+    }
+    return *this;
+  }
+  // Only allocates when a heap buffer cannot be taken over from other,
+  // which needs an allocator that neither propagates nor always compares equal
+  constexpr small_word_vector& operator=(small_word_vector&& other) noexcept(
+      traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value) {
+    if (this != &other) {
+      size_ = 0;
+      if constexpr (traits::propagate_on_container_move_assignment::value) {
+        if (alloc_ != other.alloc_) {
+          release();
+        }
+        alloc_ = other.alloc_;
+      }
+      if (!other.is_inline() && alloc_ == other.alloc_) {
+        release();
+        data_ = std::exchange(other.data_, other.inline_);
+        capacity_ = std::exchange(other.capacity_, InlineWords);
+      } else {
+        // other is inline, so this fits in any buffer, or the allocators differ
+        grow_to(other.size_);
+        std::copy_n(other.data_, other.size_, data_);
+      }
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  constexpr ~small_word_vector() {
+    release();
+  }
+
+  constexpr allocator_type get_allocator() const noexcept {
+    return alloc_;
+  }
+
+  constexpr WordType& operator[](size_type pos) noexcept {
+    return data_[pos];
+  }
+  constexpr const WordType& operator[](size_type pos) const noexcept {
+    return data_[pos];
+  }
+  constexpr WordType* data() noexcept {
+    return data_;
+  }
+  constexpr const WordType* data() const noexcept {
+    return data_;
+  }
+
+  constexpr iterator begin() noexcept {
+    return data_;
+  }
+  constexpr iterator end() noexcept {
+    return data_ + size_;
+  }
+  constexpr const_iterator begin() const noexcept {
+    return data_;
+  }
+  constexpr const_iterator end() const noexcept {
+    return data_ + size_;
+  }
+  constexpr const_iterator cbegin() const noexcept {
+    return data_;
+  }
+  constexpr const_iterator cend() const noexcept {
+    return data_ + size_;
+  }
+
+  constexpr bool empty() const noexcept {
+    return size_ == 0;
+  }
+  constexpr size_type size() const noexcept {
+    return size_;
+  }
+  constexpr size_type capacity() const noexcept {
+    return capacity_;
+  }
+  constexpr size_type max_size() const noexcept {
+    return traits::max_size(alloc_);
+  }
+  constexpr void reserve(size_type new_cap) {
+    if (new_cap > capacity_) {
+      reallocate(new_cap);
+    }
+  }
+  constexpr void shrink_to_fit() {
+    if (!is_inline() && size_ < capacity_) {
+      reallocate(size_);
+    }
+  }
+
+  constexpr void clear() noexcept {
+    size_ = 0;
+  }
+  constexpr void resize(size_type count) {
+    resize(count, WordType{});
+  }
+  constexpr void resize(size_type count, const WordType& value) {
+    grow_to(count);
+    if (count > size_) {
+      std::fill(data_ + size_, data_ + count, value);
+    }
+    size_ = count;
+  }
+  constexpr void push_back(const WordType& value) {
+    grow_to(size_ + 1);
+    data_[size_++] = value;
+  }
+  constexpr void pop_back() noexcept {
+    --size_;
+  }
+
+  friend constexpr bool operator==(const small_word_vector& lhs, const small_word_vector& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+};
+
+}  // namespace bit::detail
+
+#endif  // _BIT_SMALL_WORD_VECTOR_HPP_INCLUDED
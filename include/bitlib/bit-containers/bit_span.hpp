@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cassert>
 
+#include <ranges>
 #include <span>
 #include <cmath>
 #include <string>
@@ -339,4 +340,9 @@ constexpr bit_span<WordType, std::dynamic_extent, Policy> bit_span<WordType, Ext
 }
 
 }  // namespace bit
+
+// Like std::span, iterators into a bit_span outlive the span itself
+template <typename WordType, std::size_t Extent, typename Policy>
+inline constexpr bool std::ranges::enable_borrowed_range<bit::bit_span<WordType, Extent, Policy>> = true;
+
 #endif
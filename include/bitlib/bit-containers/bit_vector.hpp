@@ -19,11 +19,13 @@
 #include <ranges>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 // Project sources
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
 #include "bitlib/bit_concepts.hpp"
 #include "bitlib/bit-containers/bit_array_ref.hpp"
+#include "bitlib/bit-containers/bit_small_word_vector.hpp"
 #include "bitlib/bit-iterator/bit.hpp"
 
 // Third-party libraries
@@ -33,11 +35,17 @@ namespace bit {
 
 /* ****************************** BIT VECTOR ****************************** */
 //! A bit-vector with a similar interface to std::vector<bool>
-template <class WordType = uint8_t, class Allocator = std::allocator<WordType>>
+//! InlineBits > 0 keeps up to that many bits inside the object, so short
+//! vectors never touch the allocator.
+template <class WordType = uint8_t, class Allocator = std::allocator<WordType>, std::size_t InlineBits = 0>
 class bit_vector {
  private:
   static constexpr size_t digits = binary_digits<WordType>::value;
-  std::vector<WordType, Allocator> word_vector;
+  using storage_type = std::conditional_t<
+      InlineBits == 0,
+      std::vector<WordType, Allocator>,
+      detail::small_word_vector<WordType, (InlineBits + digits - 1) / digits, Allocator>>;
+  storage_type word_vector;
   size_t length_ = 0;
 
   // TODO are privates always inlined?
@@ -75,10 +83,10 @@ class bit_vector {
   using size_type = std::size_t;
   using difference_type = std::ptrdiff_t;
   using reference = bit_reference<WordType&>;  // typename std::vector<WordType>::reference>;
-  using const_reference = const reference;
+  using const_reference = const bit_reference<const WordType&>;
   using pointer = bit_pointer<WordType>;
-  using iterator = bit_iterator<typename std::vector<WordType>::iterator>;
-  using const_iterator = bit_iterator<typename std::vector<WordType>::const_iterator>;
+  using iterator = bit_iterator<typename storage_type::iterator>;
+  using const_iterator = bit_iterator<typename storage_type::const_iterator>;
 
   /*
          * Constructors, copies and moves...
@@ -103,10 +111,10 @@ class bit_vector {
       RandomAccessIt first,
       RandomAccessIt last,
       const Allocator& alloc = Allocator());
-  constexpr bit_vector(const bit_vector<WordType, Allocator>& other) = default;
-  constexpr bit_vector(const bit_vector<WordType, Allocator>& other, const Allocator& alloc);
-  constexpr bit_vector(const bit_vector<WordType, Allocator>&& other) noexcept;
-  constexpr bit_vector(const bit_vector<WordType, Allocator>&& other, const Allocator& alloc);
+  constexpr bit_vector(const bit_vector<WordType, Allocator, InlineBits>& other) = default;
+  constexpr bit_vector(const bit_vector<WordType, Allocator, InlineBits>& other, const Allocator& alloc);
+  constexpr bit_vector(bit_vector<WordType, Allocator, InlineBits>&& other) noexcept;
+  constexpr bit_vector(bit_vector<WordType, Allocator, InlineBits>&& other, const Allocator& alloc);
   constexpr bit_vector(std::initializer_list<bit_value> init, const Allocator& alloc = Allocator());
   constexpr bit_vector(std::initializer_list<bool> init, const Allocator& alloc = Allocator());
   constexpr bit_vector(std::initializer_list<WordType> init, const Allocator& alloc = Allocator());
@@ -122,15 +130,16 @@ class bit_vector {
         /*
          * Assignment
          */
-        constexpr bit_vector& operator=(const bit_vector<WordType, Allocator>& other) = default;
-        constexpr bit_vector& operator=(bit_vector<WordType, Allocator>&& other) noexcept;
+        constexpr bit_vector& operator=(const bit_vector<WordType, Allocator, InlineBits>& other) = default;
+        constexpr bit_vector& operator=(bit_vector<WordType, Allocator, InlineBits>&& other) noexcept(
+            std::is_nothrow_move_assignable_v<storage_type>);
 
 
         /*
          * Element Access
          */
         constexpr reference operator[](size_type pos);
-        constexpr reference operator[](size_type pos) const;
+        constexpr const_reference operator[](size_type pos) const;
         constexpr reference at(size_type pos);
         constexpr const_reference at(size_type pos) const;
         constexpr reference front();
@@ -180,6 +189,17 @@ class bit_vector {
         constexpr iterator insert_range(const_iterator pos, R&& range);
         template <bit_range R>
         constexpr void append_range(R&& range);
+        template <bit_sized_range R>
+        constexpr void assign_range(R&& range);
+
+        /*
+         * Shifts, as on the integral value: << moves bit i to i + n and >>
+         * to i - n, keeping the size. Vacated bits are bit0.
+         */
+        constexpr bit_vector& operator<<=(size_type n);
+        constexpr bit_vector& operator>>=(size_type n);
+        constexpr bit_vector operator<<(size_type n) const;
+        constexpr bit_vector operator>>(size_type n) const;
 
         /*
           * Slice
@@ -209,85 +229,85 @@ static_assert(bit_contiguous_sized_range<bit_vector<uint8_t>>, "bit_vector<integ
 
 
 // ------------------------ BIT VECTOR: LIFECYCLE ------------------------- //
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector() noexcept(noexcept(Allocator())) : word_vector{}, length_(0) {}
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector() noexcept(noexcept(Allocator())) : word_vector{}, length_(0) {}
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(const Allocator& alloc) noexcept : word_vector(alloc), length_(0) {}
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(const Allocator& alloc) noexcept : word_vector(alloc), length_(0) {}
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(size_type count, value_type bit_val, const Allocator& alloc)
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(size_type count, value_type bit_val, const Allocator& alloc)
     : word_vector(word_count(count), static_cast<WordType>(bit_val == bit1 ? -1 : 0), alloc),
       length_(count)
       {}
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(size_type count, const Allocator& alloc)
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(size_type count, const Allocator& alloc)
     : word_vector(word_count(count), alloc), length_(count) {}
 
 //TODO needs to work for input iterators
-template <class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 
 template <bit_iterator_c Iterator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(Iterator first, Iterator last, const Allocator& alloc)
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(Iterator first, Iterator last, const Allocator& alloc)
     : word_vector(distance(first, last), alloc), length_(distance(first, last)) {
   copy(first, last, this->begin());
 }
 
-template <class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template <bit_range _Range>
-constexpr bit_vector<WordType, Allocator>::bit_vector(std::from_range_t, _Range&& rg, const Allocator& alloc)
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(std::from_range_t, _Range&& rg, const Allocator& alloc)
     : bit_vector(rg.begin(), rg.end(), alloc) {
 }
 
-template<class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template<class RandomAccessIt>
-constexpr bit_vector<WordType, Allocator>::bit_vector(
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(
         RandomAccessIt first,
         RandomAccessIt last,
         const Allocator& alloc) {
-    bit_vector<WordType, Allocator>::range_constructor(
+    bit_vector<WordType, Allocator, InlineBits>::range_constructor(
         first,
         last,
         alloc
     );
 }
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(const bit_vector<WordType, Allocator>&& other) noexcept
-    : word_vector(std::move(other.word_vector)), length_(other.length_) {}
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(bit_vector<WordType, Allocator, InlineBits>&& other) noexcept
+    : word_vector(std::move(other.word_vector)), length_(std::exchange(other.length_, 0)) {}
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(const bit_vector<WordType, Allocator>&& other, const Allocator& alloc)
-    : word_vector(std::move(other.word_vector), alloc), length_(other.length_) {}
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(bit_vector<WordType, Allocator, InlineBits>&& other, const Allocator& alloc)
+    : word_vector(std::move(other.word_vector), alloc), length_(std::exchange(other.length_, 0)) {}
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(std::initializer_list<bit_value> init, const Allocator& alloc)
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(std::initializer_list<bit_value> init, const Allocator& alloc)
     : word_vector(alloc), length_(0) {
-    for (const_reference b : init) {
+    for (const bit_value& b : init) {
         this->push_back(b);
     }
 }
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(std::initializer_list<bool> init, const Allocator& alloc)
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(std::initializer_list<bool> init, const Allocator& alloc)
     : word_vector(alloc), length_(0) {
     for (const bool& b : init) {
         this->push_back(static_cast<bit_value>(b));
     }
 }
 
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(
         std::initializer_list<WordType> init,
         const Allocator& alloc)
     : word_vector(init, alloc), length_(this->word_vector.size() * digits) {}
 
 // Skip all characters that are not 0/1. This allows punctuation/spacing for byte/word boundaries
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(std::string_view s) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>::bit_vector(std::string_view s) {
     this->length_ = std::count(s.begin(), s.end(), '0') + std::count(s.begin(), s.end(), '1');
-    this->word_vector = std::vector<WordType, Allocator>(this->length_);
+    this->word_vector = storage_type(this->length_);
     size_type i = 0;
     for (char c : s) {
         if (c == '0') {
@@ -300,7 +320,7 @@ constexpr bit_vector<WordType, Allocator>::bit_vector(std::string_view s) {
 
 // Iterator pair constructor specializations
 // Passing in iterator over bool
-template<class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template<class RandomAccessIt>
 typename std::enable_if<
     std::is_same<
@@ -308,11 +328,11 @@ typename std::enable_if<
         bool
     >::value
 >::type
-constexpr bit_vector<WordType, Allocator>::range_constructor(
+constexpr bit_vector<WordType, Allocator, InlineBits>::range_constructor(
         RandomAccessIt first,
         RandomAccessIt last,
         const Allocator& alloc) {
-    word_vector = std::vector<WordType, Allocator>(std::distance(first, last), alloc);
+    word_vector = storage_type(std::distance(first, last), alloc);
     length_ = std::distance(first, last);
     std::transform(
             first,
@@ -323,7 +343,7 @@ constexpr bit_vector<WordType, Allocator>::range_constructor(
 }
 
 // Passing in iterator over WordType constructs via whole words
-template<class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template<class RandomAccessIt>
 typename std::enable_if<
     std::is_same<
@@ -331,19 +351,19 @@ typename std::enable_if<
         WordType
     >::value
 >::type
-constexpr bit_vector<WordType, Allocator>::range_constructor(
+constexpr bit_vector<WordType, Allocator, InlineBits>::range_constructor(
         RandomAccessIt first,
         RandomAccessIt last,
         const Allocator& alloc) {
-    word_vector = std::vector<WordType, Allocator>(first, last, alloc);
+    word_vector = storage_type(first, last, alloc);
     length_ = digits * std::distance(first, last);
 }
 
-template<class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 #if __cplusplus == 201703L
-bit_vector<WordType, Allocator>::~bit_vector() {
+bit_vector<WordType, Allocator, InlineBits>::~bit_vector() {
 #else
-constexpr bit_vector<WordType, Allocator>::~bit_vector() {
+constexpr bit_vector<WordType, Allocator, InlineBits>::~bit_vector() {
 #endif
     length_ = 0;
 }
@@ -352,9 +372,10 @@ constexpr bit_vector<WordType, Allocator>::~bit_vector() {
 
 
 // ------------------------ BIT VECTOR: ASSIGNMENT ------------------------ //
-template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>&
-bit_vector<WordType, Allocator>::operator=(bit_vector<WordType, Allocator>&& other) noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>&
+bit_vector<WordType, Allocator, InlineBits>::operator=(bit_vector<WordType, Allocator, InlineBits>&& other) noexcept(
+    std::is_nothrow_move_assignable_v<storage_type>) {
     length_ = other.length_;
     word_vector = std::move(other.word_vector);
     other.length_ = 0;
@@ -365,17 +386,17 @@ bit_vector<WordType, Allocator>::operator=(bit_vector<WordType, Allocator>&& oth
 
 
 // -------------------------- BIT VECTOR: ACCESS -------------------------- //
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::reference
-bit_vector<WordType, Allocator>::operator[](size_type pos) {return begin()[pos];}
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::reference
+bit_vector<WordType, Allocator, InlineBits>::operator[](size_type pos) {return begin()[pos];}
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::reference
-bit_vector<WordType, Allocator>::operator[](size_type pos) const {return begin()[pos];}
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_reference
+bit_vector<WordType, Allocator, InlineBits>::operator[](size_type pos) const {return begin()[pos];}
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::reference
-bit_vector<WordType, Allocator>::at(size_type pos) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::reference
+bit_vector<WordType, Allocator, InlineBits>::at(size_type pos) {
     if (pos < length_) {
         return begin()[pos];
     } else {
@@ -383,9 +404,9 @@ bit_vector<WordType, Allocator>::at(size_type pos) {
     }
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_reference
-bit_vector<WordType, Allocator>::at(size_type pos) const {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_reference
+bit_vector<WordType, Allocator, InlineBits>::at(size_type pos) const {
     if (pos < length_) {
         return begin()[pos];
     } else {
@@ -393,39 +414,39 @@ bit_vector<WordType, Allocator>::at(size_type pos) const {
     }
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::reference
-bit_vector<WordType, Allocator>::front() {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::reference
+bit_vector<WordType, Allocator, InlineBits>::front() {
     return begin()[0];
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_reference
-bit_vector<WordType, Allocator>::front() const {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_reference
+bit_vector<WordType, Allocator, InlineBits>::front() const {
     return begin()[0];
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::reference
-bit_vector<WordType, Allocator>::back() {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::reference
+bit_vector<WordType, Allocator, InlineBits>::back() {
     return begin()[length_ - 1];
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_reference
-bit_vector<WordType, Allocator>::back() const {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_reference
+bit_vector<WordType, Allocator, InlineBits>::back() const {
     return begin()[length_ - 1];
 }
 
-template<class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 constexpr WordType*
-bit_vector<WordType, Allocator>::data() noexcept {
+bit_vector<WordType, Allocator, InlineBits>::data() noexcept {
     return length_ ? &(word_vector[0]) : 0;
 }
 
-template<class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 constexpr const WordType*
-bit_vector<WordType, Allocator>::data() const noexcept {
+bit_vector<WordType, Allocator, InlineBits>::data() const noexcept {
     return word_vector.size() ? &(word_vector[0]) : 0;
 }
 // -------------------------------------------------------------------------- //
@@ -433,39 +454,39 @@ bit_vector<WordType, Allocator>::data() const noexcept {
 
 
 // ------------------------ BIT VECTOR: ITERATORS --------------------------- //
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::begin() noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::begin() noexcept {
     return iterator(word_vector.begin());
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::end() noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::end() noexcept {
     return begin() + length_;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_iterator
-bit_vector<WordType, Allocator>::begin() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_iterator
+bit_vector<WordType, Allocator, InlineBits>::begin() const noexcept {
     return const_iterator(word_vector.begin());
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_iterator
-bit_vector<WordType, Allocator>::end() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_iterator
+bit_vector<WordType, Allocator, InlineBits>::end() const noexcept {
     return const_iterator(word_vector.cbegin()) + length_;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_iterator
-bit_vector<WordType, Allocator>::cbegin() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_iterator
+bit_vector<WordType, Allocator, InlineBits>::cbegin() const noexcept {
     return const_iterator(word_vector.begin());
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::const_iterator
-bit_vector<WordType, Allocator>::cend() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::const_iterator
+bit_vector<WordType, Allocator, InlineBits>::cend() const noexcept {
     return const_iterator(word_vector.cbegin()) + length_;
 }
 // -------------------------------------------------------------------------- //
@@ -473,36 +494,36 @@ bit_vector<WordType, Allocator>::cend() const noexcept {
 
 
 // ------------------------ BIT VECTOR: CAPACITY ---------------------------- //
-template<class WordType, class Allocator>
-constexpr bool bit_vector<WordType, Allocator>::empty() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bool bit_vector<WordType, Allocator, InlineBits>::empty() const noexcept {
     return length_ == 0;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::size_type
-bit_vector<WordType, Allocator>::size() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::size_type
+bit_vector<WordType, Allocator, InlineBits>::size() const noexcept {
     return length_;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::size_type
-bit_vector<WordType, Allocator>::max_size() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::size_type
+bit_vector<WordType, Allocator, InlineBits>::max_size() const noexcept {
     return word_vector.max_size() * digits;
 }
 
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::reserve(size_type new_cap) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::reserve(size_type new_cap) {
     word_vector.reserve(word_count(new_cap));
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::size_type
-bit_vector<WordType, Allocator>::capacity() const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::size_type
+bit_vector<WordType, Allocator, InlineBits>::capacity() const noexcept {
     return word_vector.capacity() * digits;
 }
 
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::shrink_to_fit() {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::shrink_to_fit() {
     word_vector.shrink_to_fit();
 }
 // -------------------------------------------------------------------------- //
@@ -510,14 +531,14 @@ constexpr void bit_vector<WordType, Allocator>::shrink_to_fit() {
 
 
 // ------------------------ BIT VECTOR: MODIFYING -------------------------- //
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::clear() noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::clear() noexcept {
     word_vector.clear(); length_ = 0;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::insert(
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::insert(
         const_iterator pos,
         const value_type& value) {
     const auto d = distance(cbegin(), pos);
@@ -531,12 +552,12 @@ bit_vector<WordType, Allocator>::insert(
 }
 
 // TODO should use std::insert to maintain the constant amortized time.
-template <class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::insert(
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::insert(
     const_iterator pos,
     size_type count,
-    const bit_vector<WordType, Allocator>::value_type& value) {
+    const bit_vector<WordType, Allocator, InlineBits>::value_type& value) {
   const auto d = distance(cbegin(), pos);
   if (count == 0) {
     return begin() + d;
@@ -553,10 +574,10 @@ bit_vector<WordType, Allocator>::insert(
   return begin() + d;
 }
 
-template <class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template <bit_iterator_c OtherIt>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::insert(
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::insert(
     const_iterator pos,
     OtherIt first,
     OtherIt last) {
@@ -577,9 +598,9 @@ bit_vector<WordType, Allocator>::insert(
   return begin() + d;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::erase(iterator pos) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::erase(iterator pos) {
   difference_type d = distance(begin(), pos);
   shift_left(pos, begin() + length_, 1);
   length_ -= 1;
@@ -589,9 +610,9 @@ bit_vector<WordType, Allocator>::erase(iterator pos) {
   return begin() + d;
 }
 
-template<class WordType, class Allocator>
-constexpr typename bit_vector<WordType, Allocator>::iterator
-bit_vector<WordType, Allocator>::erase(iterator first, iterator last) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr typename bit_vector<WordType, Allocator, InlineBits>::iterator
+bit_vector<WordType, Allocator, InlineBits>::erase(iterator first, iterator last) {
     const auto d = distance(begin(), first);
     auto count = distance(first, last);
     if (count == 0) {
@@ -603,8 +624,8 @@ bit_vector<WordType, Allocator>::erase(iterator first, iterator last) {
     return begin() + d;
 }
 
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::push_back(const value_type& value) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::push_back(const value_type& value) {
     if (this->word_vector.size()*digits == length_) {
         word_vector.push_back(0U);
     }
@@ -613,8 +634,8 @@ constexpr void bit_vector<WordType, Allocator>::push_back(const value_type& valu
     return;
 }
 
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::pop_back() {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::pop_back() {
     length_ -= 1;
     if (length_ % digits == 0) {
         word_vector.pop_back();
@@ -622,48 +643,87 @@ constexpr void bit_vector<WordType, Allocator>::pop_back() {
     return;
 }
 
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::resize(size_type count) {
-    word_vector.resize(word_count(count));
-    length_ = count;
-    return;
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::resize(size_type count) {
+    resize(count, bit0);
 }
 
-template<class WordType, class Allocator>
-constexpr void bit_vector<WordType, Allocator>::resize(size_type count, const value_type& value) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::resize(size_type count, const value_type& value) {
     auto old_length = length_;
     word_vector.resize(word_count(count));
     length_ = count;
     if (length_ > old_length) {
-        fill(begin() + length_, end(), value);
+        fill(begin() + old_length, end(), value);
     }
     return;
 }
 // -------------------------------------------------------------------------- //
 
-template <class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template <bit_range R>
-constexpr bit_vector<WordType, Allocator>::iterator bit_vector<WordType, Allocator>::insert_range(const_iterator pos, R&& range) {
+constexpr bit_vector<WordType, Allocator, InlineBits>::iterator bit_vector<WordType, Allocator, InlineBits>::insert_range(const_iterator pos, R&& range) {
   return this->insert(pos, range.begin(), range.end());
 }
 
-template <class WordType, class Allocator>
+template <class WordType, class Allocator, std::size_t InlineBits>
 template <bit_range R>
-constexpr void bit_vector<WordType, Allocator>::append_range(R&& range) {
+constexpr void bit_vector<WordType, Allocator, InlineBits>::append_range(R&& range) {
   this->insert(this->end(), range.begin(), range.end());
 }
 
+// Replaces the contents, evaluating lazy bit expressions in a single pass
+template <class WordType, class Allocator, std::size_t InlineBits>
+template <bit_sized_range R>
+constexpr void bit_vector<WordType, Allocator, InlineBits>::assign_range(R&& range) {
+  const size_type count = std::ranges::size(range);
+  word_vector.resize(word_count(count));
+  length_ = count;
+  copy(range.begin(), range.end(), this->begin());
+}
+
+/*
+  * Shifts
+*/
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>& bit_vector<WordType, Allocator, InlineBits>::operator<<=(size_type n) {
+  n = std::min(n, length_);
+  fill(begin(), shift_right(begin(), end(), static_cast<difference_type>(n)), bit0);
+  return *this;
+}
+
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits>& bit_vector<WordType, Allocator, InlineBits>::operator>>=(size_type n) {
+  n = std::min(n, length_);
+  fill(shift_left(begin(), end(), static_cast<difference_type>(n)), end(), bit0);
+  return *this;
+}
+
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits> bit_vector<WordType, Allocator, InlineBits>::operator<<(size_type n) const {
+  bit_vector shifted(*this);
+  shifted <<= n;
+  return shifted;
+}
+
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_vector<WordType, Allocator, InlineBits> bit_vector<WordType, Allocator, InlineBits>::operator>>(size_type n) const {
+  bit_vector shifted(*this);
+  shifted >>= n;
+  return shifted;
+}
+
 /*
   * Slice
 */
-template <class WordType, class Allocator>
-constexpr bit_array_ref<std::dynamic_extent, WordType /*, Policy*/> bit_vector<WordType, Allocator>::operator()(size_type begin, size_type end) const noexcept {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr bit_array_ref<std::dynamic_extent, WordType /*, Policy*/> bit_vector<WordType, Allocator, InlineBits>::operator()(size_type begin, size_type end) const noexcept {
   return bit_array_ref<std::dynamic_extent, WordType /*, Policy*/>(&this->at(begin), end - begin);
 }
 
 // ------------------------ BIT VECTOR: DEBUGGING -------------------------- //
-template <class WordType, class Allocator>
-constexpr std::string bit_vector<WordType, Allocator>::debug_string(const_iterator first, const_iterator end) {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr std::string bit_vector<WordType, Allocator, InlineBits>::debug_string(const_iterator first, const_iterator end) {
   std::string ret = "";
   auto position = 0;
   for (const_iterator it = first; it != end; ++it) {
@@ -678,8 +738,8 @@ constexpr std::string bit_vector<WordType, Allocator>::debug_string(const_iterat
   return ret;
 }
 
-template<class WordType, class Allocator>
-constexpr std::string bit_vector<WordType, Allocator>::debug_string() {
+template <class WordType, class Allocator, std::size_t InlineBits>
+constexpr std::string bit_vector<WordType, Allocator, InlineBits>::debug_string() {
   return debug_string(begin(), end());
 }
 // -------------------------------------------------------------------------- //
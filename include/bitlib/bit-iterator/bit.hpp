@@ -22,9 +22,11 @@
 #include "bit_details.hpp"
 #include "bit_iterator.hpp"
 #include "bit_reference.hpp"
+#include "bit_set_bits_view.hpp"
 #include "bit_value.hpp"
 #include "bit_word_pointer_adapter.hpp"
 #include "bit_word_reference_adapter.hpp"
+#include "bit_word_view.hpp"
 
 // Third-party libraries
 // Miscellaneous
@@ -209,6 +209,12 @@ constexpr T _bextr(T src, size_t start, size_t len) noexcept;
 template <class T, class... X>
 constexpr T _bextr(T src, size_t start, size_t len, X...) noexcept;
 
+// Parallel bit extraction and deposit
+template <class T>
+constexpr T _pext(T src, T msk) noexcept;
+template <class T>
+constexpr T _pdep(T src, T msk) noexcept;
+
 // Bit swap
 template <class T>
 constexpr T _bitswap(T src) noexcept;
@@ -370,6 +376,82 @@ constexpr T _bextr(T src, size_t start, size_t len, X...) noexcept {
 }
 // -------------------------------------------------------------------------- //
 
+// ---- IMPLEMENTATION DETAILS: INSTRUCTIONS: PARALLEL EXTRACT / DEPOSIT ---- //
+// BMI2 pext/pdep are single-cycle on Intel and Zen 3+, but microcoded on
+// Zen 1/2 with a cost per set mask bit, so those targets (and any build
+// defining BITLIB_NO_PEXT) use the run-at-a-time fallback below
+#if defined(__BMI2__) && !defined(NO_X86_INTRINSICS) && !defined(BITLIB_NO_PEXT) && \
+    !defined(__tune_znver1__) && !defined(__tune_znver2__)
+#define BITLIB_PEXT
+#endif
+
+// Gathers the bits of src selected by msk into the lsbs of the result.
+// Without BMI2, each run of consecutive mask bits moves with one shift,
+// so field masks cost a few operations rather than one per bit.
+template <class T>
+constexpr T _pext(T src, T msk) noexcept {
+  static_assert(binary_digits<T>::value, "");
+  using U = std::make_unsigned_t<T>;
+#ifdef BITLIB_PEXT
+  constexpr size_t digits = binary_digits<T>::value;
+  if !consteval {
+    if constexpr (digits <= 32) {
+      return static_cast<T>(_pext_u32(static_cast<U>(src), static_cast<U>(msk)));
+    } else if constexpr (digits == 64) {
+      return static_cast<T>(_pext_u64(static_cast<U>(src), static_cast<U>(msk)));
+    }
+  }
+#endif
+  U m = static_cast<U>(msk);
+  if (m == static_cast<U>(-1)) {
+    return src;
+  }
+  U dst = 0;
+  size_t k = 0;
+  while (m) {
+    const size_t start = std::countr_zero(m);
+    const size_t run = std::countr_one(static_cast<U>(m >> start));
+    const U field = static_cast<U>(static_cast<U>(static_cast<U>(src) >> start) & _mask<U>(run));
+    dst |= static_cast<U>(field << k);
+    k += run;
+    m &= static_cast<U>(~static_cast<U>(_mask<U>(run) << start));
+  }
+  return static_cast<T>(dst);
+}
+
+// Scatters the lsbs of src to the bits selected by msk, clearing the rest
+template <class T>
+constexpr T _pdep(T src, T msk) noexcept {
+  static_assert(binary_digits<T>::value, "");
+  using U = std::make_unsigned_t<T>;
+#ifdef BITLIB_PEXT
+  constexpr size_t digits = binary_digits<T>::value;
+  if !consteval {
+    if constexpr (digits <= 32) {
+      return static_cast<T>(_pdep_u32(static_cast<U>(src), static_cast<U>(msk)));
+    } else if constexpr (digits == 64) {
+      return static_cast<T>(_pdep_u64(static_cast<U>(src), static_cast<U>(msk)));
+    }
+  }
+#endif
+  U m = static_cast<U>(msk);
+  if (m == static_cast<U>(-1)) {
+    return src;
+  }
+  U dst = 0;
+  size_t k = 0;
+  while (m) {
+    const size_t start = std::countr_zero(m);
+    const size_t run = std::countr_one(static_cast<U>(m >> start));
+    const U field = static_cast<U>(static_cast<U>(static_cast<U>(src) >> k) & _mask<U>(run));
+    dst |= static_cast<U>(field << start);
+    k += run;
+    m &= static_cast<U>(~static_cast<U>(_mask<U>(run) << start));
+  }
+  return static_cast<T>(dst);
+}
+// -------------------------------------------------------------------------- //
+
 // ------------- IMPLEMENTATION DETAILS: INSTRUCTIONS: BIT SWAP ------------- //
 // Reverses the order of the bits with or without of compiler intrinsics
 template <class T>
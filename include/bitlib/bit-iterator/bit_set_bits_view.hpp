@@ -0,0 +1,184 @@
+// =========================== BIT SET BITS VIEW ============================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_set_bits_view.hpp
+// Description: A view of the indices of the set bits of a bit range
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_SET_BITS_VIEW_HPP_INCLUDED
+#define _BIT_SET_BITS_VIEW_HPP_INCLUDED
+
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "bitlib/bit-containers/bit_bitsof.hpp"
+#include "bit_details.hpp"
+#include "bit_iterator.hpp"
+
+namespace bit {
+
+/**
+ * @brief Iterates the indices of the set bits of a bit range
+ *
+ * The iterator keeps the not yet visited set bits of the current storage
+ * word, so ++ is a w &= w - 1 and a countr_zero, and only loads another
+ * word once the current one is exhausted. -- searches down from the
+ * current position with countl_zero. Indices are relative to the start
+ * of the range.
+ */
+template <typename Iterator>
+class bit_set_bits_iterator {
+ public:
+  using iterator_type = Iterator;
+  using word_type = std::remove_cv_t<std::iter_value_t<Iterator>>;
+  using value_type = std::size_t;
+  using reference = value_type;
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using iterator_concept = std::bidirectional_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+
+ private:
+  using uword_type = std::make_unsigned_t<word_type>;
+  static constexpr size_type digits = bitsof<word_type>();
+
+  // Bit indices are kept relative to the first storage word: the range is
+  // [lo_, hi_) and word k holds [k * digits, (k + 1) * digits)
+  Iterator base_{};
+  size_type lo_ = 0;
+  size_type hi_ = 0;
+  size_type k_ = 0;
+  uword_type pending_ = 0;
+
+  // Word k with the bits outside the range cleared
+  constexpr uword_type load(size_type k) const {
+    uword_type w = static_cast<uword_type>(base_[static_cast<difference_type>(k)]);
+    if (k == lo_ / digits) {
+      w &= static_cast<uword_type>(~_mask<uword_type>(lo_ % digits));
+    }
+    if (k == hi_ / digits) {
+      w &= _mask<uword_type>(hi_ % digits);
+    }
+    return w;
+  }
+
+  constexpr size_type word_count() const {
+    return (hi_ + digits - 1) / digits;
+  }
+
+  // Moves forward to the first word from k_ on with a pending set bit
+  constexpr void skip_empty() {
+    while (pending_ == 0 && ++k_ < word_count()) {
+      pending_ = load(k_);
+    }
+  }
+
+ public:
+  constexpr bit_set_bits_iterator() = default;
+
+  /**
+   * @brief The first set bit at or after first, or the end iterator if
+   *        at_end
+   */
+  constexpr bit_set_bits_iterator(bit_iterator<Iterator> first, size_type count, bool at_end)
+      : base_(first.base()), lo_(first.position()), hi_(first.position() + count) {
+    if (at_end || count == 0) {
+      k_ = word_count();
+    } else {
+      k_ = lo_ / digits;
+      pending_ = load(k_);
+      skip_empty();
+    }
+  }
+
+  constexpr value_type operator*() const {
+    return k_ * digits + static_cast<size_type>(std::countr_zero(pending_)) - lo_;
+  }
+
+  constexpr bit_set_bits_iterator& operator++() {
+    pending_ &= static_cast<uword_type>(pending_ - 1);
+    skip_empty();
+    return *this;
+  }
+  constexpr bit_set_bits_iterator operator++(int) {
+    bit_set_bits_iterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  // Precondition: a set bit precedes the current position
+  constexpr bit_set_bits_iterator& operator--() {
+    const size_type pos = (pending_ != 0) ? k_ * digits + static_cast<size_type>(std::countr_zero(pending_))
+                                          : hi_;
+    size_type k = pos / digits;
+    uword_type below = (pos % digits) ? static_cast<uword_type>(load(k) & _mask<uword_type>(pos % digits))
+                                      : uword_type{0};
+    while (below == 0) {
+      below = load(--k);
+    }
+    const size_type top = digits - 1 - static_cast<size_type>(std::countl_zero(below));
+    k_ = k;
+    pending_ = static_cast<uword_type>(load(k) & ~_mask<uword_type>(top));
+    return *this;
+  }
+  constexpr bit_set_bits_iterator operator--(int) {
+    bit_set_bits_iterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  friend constexpr bool operator==(const bit_set_bits_iterator& lhs, const bit_set_bits_iterator& rhs) {
+    return lhs.k_ == rhs.k_ && lhs.pending_ == rhs.pending_;
+  }
+};
+
+/**
+ * @brief The indices of the set bits of [first, last), in increasing order
+ *
+ * A bidirectional std::ranges::view; iterate it backward with
+ * std::views::reverse.
+ */
+template <typename Iterator>
+class bit_set_bits_view : public std::ranges::view_interface<bit_set_bits_view<Iterator>> {
+ public:
+  using iterator = bit_set_bits_iterator<Iterator>;
+
+ private:
+  iterator begin_{};
+  iterator end_{};
+
+ public:
+  constexpr bit_set_bits_view() = default;
+  constexpr bit_set_bits_view(bit_iterator<Iterator> first, bit_iterator<Iterator> last)
+      : begin_(first, static_cast<std::size_t>(last - first), false),
+        end_(first, static_cast<std::size_t>(last - first), true) {
+  }
+
+  constexpr iterator begin() const {
+    return begin_;
+  }
+  constexpr iterator end() const {
+    return end_;
+  }
+};
+
+template <typename Iterator>
+constexpr bit_set_bits_view<Iterator> set_bits(bit_iterator<Iterator> first, bit_iterator<Iterator> last) {
+  return bit_set_bits_view<Iterator>(first, last);
+}
+
+template <std::ranges::borrowed_range Range>
+  requires bit_range<Range>
+constexpr auto set_bits(Range&& range) {
+  return set_bits(std::ranges::begin(range), std::ranges::end(range));
+}
+
+}  // namespace bit
+
+template <typename Iterator>
+inline constexpr bool std::ranges::enable_borrowed_range<bit::bit_set_bits_view<Iterator>> = true;
+
+#endif  // _BIT_SET_BITS_VIEW_HPP_INCLUDED
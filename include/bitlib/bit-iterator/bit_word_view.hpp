@@ -0,0 +1,219 @@
+// ============================= BIT WORD VIEW ============================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_word_view.hpp
+// Description: A view of a bit range as the storage words it touches
+// Contributor: Peter McLean [2025]
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_WORD_VIEW_HPP_INCLUDED
+#define _BIT_WORD_VIEW_HPP_INCLUDED
+
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+#include "bitlib/bit-containers/bit_bitsof.hpp"
+#include "bit_details.hpp"
+#include "bit_iterator.hpp"
+
+namespace bit {
+
+/**
+ * @brief One storage word of a bit range
+ *
+ * word is the storage word as it is in memory and mask marks the bits of
+ * it that lie inside the range. Only the first and last word of a range
+ * can be partial.
+ */
+template <typename WordType>
+struct word_segment {
+  using word_type = WordType;
+  using size_type = std::size_t;
+
+  word_type word;
+  word_type mask;
+
+  /**
+   * @brief Index of the first bit of the range within word
+   */
+  constexpr size_type position() const noexcept {
+    return static_cast<size_type>(std::countr_zero(static_cast<std::make_unsigned_t<word_type>>(mask)));
+  }
+
+  /**
+   * @brief Number of bits of the range within word
+   */
+  constexpr size_type size() const noexcept {
+    return static_cast<size_type>(std::popcount(static_cast<std::make_unsigned_t<word_type>>(mask)));
+  }
+
+  constexpr bool full() const noexcept {
+    return mask == static_cast<word_type>(~word_type{0});
+  }
+
+  /**
+   * @brief The bits of the range, shifted down to bit 0
+   */
+  constexpr word_type value() const noexcept {
+    return lsr(static_cast<word_type>(word & mask), position());
+  }
+
+  friend constexpr bool operator==(const word_segment&, const word_segment&) = default;
+};
+
+/**
+ * @brief Iterates the storage words under a pair of bit_iterators
+ *
+ * Dereferencing yields a word_segment by value. base() is the underlying
+ * word iterator, so a kernel can write a segment back with
+ * `*it.base() = _bitblend(*it.base(), result, (*it).mask)`.
+ */
+template <typename Iterator>
+class bit_word_iterator {
+ public:
+  using iterator_type = Iterator;
+  using word_type = std::remove_cv_t<std::iter_value_t<Iterator>>;
+  using value_type = word_segment<word_type>;
+  using reference = value_type;
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using iterator_concept = std::random_access_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+
+ private:
+  static constexpr size_type digits = bitsof<word_type>();
+
+  Iterator it_{};
+  bit_iterator<Iterator> first_{};
+  bit_iterator<Iterator> last_{};
+
+ public:
+  constexpr bit_word_iterator() = default;
+  constexpr bit_word_iterator(Iterator it, bit_iterator<Iterator> first, bit_iterator<Iterator> last)
+      : it_(it), first_(first), last_(last) {
+  }
+
+  constexpr Iterator base() const {
+    return it_;
+  }
+
+  /**
+   * @brief Bit offset of the segment's first bit from the start of the range
+   */
+  constexpr size_type offset() const {
+    if (it_ == first_.base()) {
+      return 0;
+    }
+    return static_cast<size_type>(it_ - first_.base()) * digits - first_.position();
+  }
+
+  constexpr value_type operator*() const {
+    const size_type lo = (it_ == first_.base()) ? first_.position() : 0;
+    const size_type hi = (it_ == last_.base()) ? last_.position() : digits;
+    return value_type{static_cast<word_type>(*it_), _mask<word_type, _mask_len::unknown>(hi - lo, lo)};
+  }
+
+  constexpr value_type operator[](difference_type n) const {
+    return *(*this + n);
+  }
+
+  constexpr bit_word_iterator& operator++() {
+    ++it_;
+    return *this;
+  }
+  constexpr bit_word_iterator operator++(int) {
+    bit_word_iterator tmp = *this;
+    ++it_;
+    return tmp;
+  }
+  constexpr bit_word_iterator& operator--() {
+    --it_;
+    return *this;
+  }
+  constexpr bit_word_iterator operator--(int) {
+    bit_word_iterator tmp = *this;
+    --it_;
+    return tmp;
+  }
+  constexpr bit_word_iterator& operator+=(difference_type n) {
+    it_ += n;
+    return *this;
+  }
+  constexpr bit_word_iterator& operator-=(difference_type n) {
+    it_ -= n;
+    return *this;
+  }
+  friend constexpr bit_word_iterator operator+(bit_word_iterator it, difference_type n) {
+    return it += n;
+  }
+  friend constexpr bit_word_iterator operator+(difference_type n, bit_word_iterator it) {
+    return it += n;
+  }
+  friend constexpr bit_word_iterator operator-(bit_word_iterator it, difference_type n) {
+    return it -= n;
+  }
+  friend constexpr difference_type operator-(const bit_word_iterator& lhs, const bit_word_iterator& rhs) {
+    return static_cast<difference_type>(lhs.it_ - rhs.it_);
+  }
+  friend constexpr bool operator==(const bit_word_iterator& lhs, const bit_word_iterator& rhs) {
+    return lhs.it_ == rhs.it_;
+  }
+  friend constexpr auto operator<=>(const bit_word_iterator& lhs, const bit_word_iterator& rhs) {
+    return (lhs.it_ - rhs.it_) <=> 0;
+  }
+};
+
+/**
+ * @brief The storage words of [first, last) as word_segments
+ *
+ * Algorithms that work a word at a time can iterate this instead of
+ * splitting a range into head, whole words and tail themselves. It is a
+ * random access std::ranges::view.
+ */
+template <typename Iterator>
+class bit_word_view : public std::ranges::view_interface<bit_word_view<Iterator>> {
+ public:
+  using iterator = bit_word_iterator<Iterator>;
+
+ private:
+  iterator begin_{};
+  iterator end_{};
+
+ public:
+  constexpr bit_word_view() = default;
+  constexpr bit_word_view(bit_iterator<Iterator> first, bit_iterator<Iterator> last)
+      : begin_(first.base(), first, last),
+        end_((first == last)            ? first.base()
+             : (last.position() != 0) ? std::next(last.base())
+                                      : last.base(),
+             first, last) {
+  }
+
+  constexpr iterator begin() const {
+    return begin_;
+  }
+  constexpr iterator end() const {
+    return end_;
+  }
+};
+
+template <typename Iterator>
+constexpr bit_word_view<Iterator> words(bit_iterator<Iterator> first, bit_iterator<Iterator> last) {
+  return bit_word_view<Iterator>(first, last);
+}
+
+template <std::ranges::borrowed_range Range>
+  requires bit_range<Range>
+constexpr auto words(Range&& range) {
+  return words(std::ranges::begin(range), std::ranges::end(range));
+}
+
+}  // namespace bit
+
+template <typename Iterator>
+inline constexpr bool std::ranges::enable_borrowed_range<bit::bit_word_view<Iterator>> = true;
+
+#endif  // _BIT_WORD_VIEW_HPP_INCLUDED
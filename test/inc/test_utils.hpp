@@ -153,8 +153,9 @@ bit::bit_vector<WordType> get_random_bvec(
 ) {
     constexpr auto digits = bit::binary_digits<WordType>::value;
     auto words = (size + digits - 1) / digits;
-    auto word_vec = get_random_vec(words);
-    bit::bit_vector<WordType> ret(word_vec.begin(), word_vec.end());
+    auto word_vec = get_random_vec<WordType>(words);
+    bit::bit_vector<WordType> ret(words * digits);
+    std::copy(word_vec.begin(), word_vec.end(), ret.begin().base());
     ret.resize(size);
     return ret;
 }
@@ -2,6 +2,7 @@
 
 #include "bitlib/bitlib.hpp"
 #include "gtest/gtest.h"
+#include "test_utils.hpp"
 
 TEST(BitAddition, Basic) {
   auto bits = 0xF'0F_b;
@@ -14,3 +15,54 @@ TEST(BitAddition, LowBits) {
   EXPECT_EQ(0, bit::addition(bits.begin(), bits.end(), 1'1_b));
   EXPECT_EQ(0x7'10_b, bits);
 }
+
+TEST(BitAddition, MultiWordScalar) {
+  // The scalar operand only applies to the least significant word
+  bit::bit_vector<uint8_t> bits(24, bit::bit0);
+  EXPECT_EQ(0, bit::addition(bits.begin(), bits.end(), static_cast<uint8_t>(0x1u)));
+  EXPECT_EQ(bits, bit::bit_vector<uint8_t>("100000000000000000000000"));
+}
+
+TEST(BitAddition, Range) {
+  auto lhs = 0x10'00FF_b;
+  auto rhs = 0x10'0001_b;
+  auto sum = 0x10'0_b;
+  EXPECT_EQ(0, bit::addition(lhs.begin(), lhs.end(), rhs.begin(), sum.begin()));
+  EXPECT_EQ(0x10'0100_b, sum);
+  auto ones = 0x10'FFFF_b;
+  EXPECT_EQ(1, bit::addition(ones.begin(), ones.end(), rhs.begin(), ones.begin()));
+  EXPECT_EQ(0x10'0000_b, ones);
+}
+
+template <typename WordType>
+void check_range_addition() {
+  // Compare against a bit-serial ripple carry over every width and alignment
+  auto lhs = get_random_bvec<WordType>(256);
+  auto rhs = get_random_bvec<WordType>(256);
+  for (size_t width = 1; width <= 200; ++width) {
+    for (size_t offset1 : {0, 3}) {
+      for (size_t offset2 : {0, 5}) {
+        bit::bit_vector<WordType> sum(width + 7);
+        const auto first1 = lhs.begin() + offset1;
+        const auto first2 = rhs.begin() + offset2;
+        const auto carry = bit::addition(first1, first1 + width, first2, sum.begin() + 1);
+        bool c = false;
+        for (size_t i = 0; i < width; ++i) {
+          const bool a = static_cast<bool>(first1[i]);
+          const bool b = static_cast<bool>(first2[i]);
+          const bool s = a ^ b ^ c;
+          ASSERT_EQ(static_cast<bool>(sum[i + 1]), s) << width << " at " << i;
+          c = (a && b) || (c && (a != b));
+        }
+        EXPECT_EQ(carry, static_cast<unsigned char>(c)) << width;
+        EXPECT_EQ(sum[0], bit::bit0);
+      }
+    }
+  }
+}
+
+TEST(BitAddition, RangeRandom) {
+  check_range_addition<uint8_t>();
+  check_range_addition<uint16_t>();
+  check_range_addition<uint64_t>();
+}
@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <span>
 #include <stdexcept>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "bitlib/bit-containers/bit_array.hpp"
 #include "bitlib/bit-containers/bit_array_dynamic_extent.hpp"
@@ -492,3 +498,170 @@ TEST(BitArrayTest, SliceModify) {
   EXPECT_EQ(span2[3], bit::bit0);
   EXPECT_EQ(arr, 0x24'DEADBE6F_b);
 }
+
+// The fixed-extent kernels against the bit-by-bit reference of std::vector<bool>
+template <std::size_t N, typename W>
+void check_fixed_kernels(std::mt19937& gen) {
+  using array_type = bit::bit_array<N, W>;
+  auto random_array = [&](std::vector<bool>& ref) {
+    array_type a;
+    ref.assign(N, false);
+    for (std::size_t i = 0; i < N; ++i) {
+      ref[i] = gen() & 1;
+      a[i] = ref[i] ? bit::bit1 : bit::bit0;
+    }
+    // Garbage in the padding bits must never be observed
+    if constexpr (N % bit::bitsof<W>() != 0) {
+      a.data()[N / bit::bitsof<W>()] |= static_cast<W>(~bit::_mask<W, bit::_mask_len::unknown>(N % bit::bitsof<W>()));
+    }
+    return a;
+  };
+  auto matches = [](const array_type& a, const std::vector<bool>& ref) {
+    return std::equal(a.begin(), a.end(), ref.begin(), ref.end(), comparator);
+  };
+  for (int rep = 0; rep < 20; ++rep) {
+    std::vector<bool> ref_a, ref_b;
+    array_type a = random_array(ref_a);
+    const array_type b = random_array(ref_b);
+
+    EXPECT_EQ(a == b, ref_a == ref_b);
+    array_type c = a;
+    EXPECT_TRUE(c == a);
+    if (N) {
+      c[N - 1] = ~c[N - 1];
+      EXPECT_FALSE(c == a);
+    }
+
+    EXPECT_EQ(bit::count(a, bit::bit1), std::count(ref_a.begin(), ref_a.end(), true));
+    EXPECT_EQ(bit::count(a, bit::bit0), std::count(ref_a.begin(), ref_a.end(), false));
+    for (bit::bit_value value : {bit::bit0, bit::bit1}) {
+      EXPECT_EQ(bit::find(b, value) - b.begin(), std::find(ref_b.begin(), ref_b.end(), value == bit::bit1) - ref_b.begin());
+    }
+
+    std::vector<bool> ref(N);
+    array_type d = a;
+    d &= b;
+    std::transform(ref_a.begin(), ref_a.end(), ref_b.begin(), ref.begin(), std::logical_and<>{});
+    EXPECT_TRUE(matches(d, ref));
+    d = a;
+    d |= b;
+    std::transform(ref_a.begin(), ref_a.end(), ref_b.begin(), ref.begin(), std::logical_or<>{});
+    EXPECT_TRUE(matches(d, ref));
+    d = a;
+    d ^= b;
+    std::transform(ref_a.begin(), ref_a.end(), ref_b.begin(), ref.begin(), std::not_equal_to<>{});
+    EXPECT_TRUE(matches(d, ref));
+    array_type e = a ^ b;
+    EXPECT_TRUE(e == d);
+    e = ~(a | b);
+    std::transform(ref_a.begin(), ref_a.end(), ref_b.begin(), ref.begin(), [](bool x, bool y) { return !(x || y); });
+    EXPECT_TRUE(matches(e, ref));
+    d = a;
+    d.flip();
+    std::transform(ref_a.begin(), ref_a.end(), ref.begin(), std::logical_not<>{});
+    EXPECT_TRUE(matches(d, ref));
+
+    const std::size_t n = std::uniform_int_distribution<std::size_t>(0, N + 1)(gen);
+    d = a;
+    auto it = bit::shift_left(d, n);
+    ref = ref_a;
+    std::fill(std::shift_left(ref.begin(), ref.end(), n), ref.end(), false);
+    EXPECT_TRUE(matches(d, ref)) << "shift_left " << n;
+    EXPECT_EQ(it - d.begin(), n ? static_cast<std::ptrdiff_t>(N - std::min(n, N)) : static_cast<std::ptrdiff_t>(N));
+    d = a;
+    bit::shift_right(d, n);
+    ref = ref_a;
+    std::fill(ref.begin(), std::shift_right(ref.begin(), ref.end(), n), false);
+    EXPECT_TRUE(matches(d, ref)) << "shift_right " << n;
+
+    d.fill(bit::bit1);
+    EXPECT_EQ(bit::count(d, bit::bit1), static_cast<std::ptrdiff_t>(N));
+    EXPECT_EQ(bit::find(d, bit::bit0), d.end());
+  }
+}
+
+TEST(ArrayTest, FixedKernels) {
+  std::mt19937 gen(5);
+  check_fixed_kernels<1, uint8_t>(gen);
+  check_fixed_kernels<11, uint16_t>(gen);
+  check_fixed_kernels<13, uint8_t>(gen);
+  check_fixed_kernels<64, uint64_t>(gen);
+  check_fixed_kernels<65, uint64_t>(gen);
+  check_fixed_kernels<100, uint32_t>(gen);
+  check_fixed_kernels<257, uint64_t>(gen);
+  check_fixed_kernels<512, uint64_t>(gen);
+  check_fixed_kernels<513, uint64_t>(gen);
+  check_fixed_kernels<1000, uint8_t>(gen);
+  check_fixed_kernels<4099, uint32_t>(gen);
+}
+
+TEST(ArrayTest, FixedKernelsLarge) {
+  // Far past the unrolled kernels, so this must compile quickly and run
+  // the range algorithms
+  constexpr std::size_t N = std::size_t{1} << 20;
+  using array_type = bit::bit_array<N, uint64_t>;
+  std::mt19937_64 gen(7);
+  auto a = std::make_unique<array_type>();
+  auto b = std::make_unique<array_type>();
+  for (auto& word : std::span(a->data(), a->size() / 64)) {
+    word = gen();
+  }
+  for (auto& word : std::span(b->data(), b->size() / 64)) {
+    word = gen();
+  }
+  std::vector<bool> ref_a(N), ref_b(N);
+  for (std::size_t i = 0; i < N; ++i) {
+    ref_a[i] = (*a)[i] == bit::bit1;
+    ref_b[i] = (*b)[i] == bit::bit1;
+  }
+  auto matches = [](const array_type& x, const std::vector<bool>& ref) {
+    return std::equal(x.begin(), x.end(), ref.begin(), ref.end(), comparator);
+  };
+
+  auto c = std::make_unique<array_type>(*a);
+  EXPECT_TRUE(*c == *a);
+  (*c)[N - 1] = ~(*c)[N - 1];
+  EXPECT_FALSE(*c == *a);
+  EXPECT_EQ(bit::count(*a, bit::bit1), std::count(ref_a.begin(), ref_a.end(), true));
+  EXPECT_EQ(bit::find(*a, bit::bit1) - a->begin(), std::find(ref_a.begin(), ref_a.end(), true) - ref_a.begin());
+
+  std::vector<bool> ref(N);
+  *c = *a;
+  *c ^= *b;
+  std::transform(ref_a.begin(), ref_a.end(), ref_b.begin(), ref.begin(), std::not_equal_to<>{});
+  EXPECT_TRUE(matches(*c, ref));
+  *c = ~(*a & *b);
+  std::transform(ref_a.begin(), ref_a.end(), ref_b.begin(), ref.begin(), [](bool x, bool y) { return !(x && y); });
+  EXPECT_TRUE(matches(*c, ref));
+  c->flip();
+  ref.flip();
+  EXPECT_TRUE(matches(*c, ref));
+
+  for (std::size_t n : {std::size_t{0}, std::size_t{1}, std::size_t{64}, std::size_t{12345}, N - 3, N}) {
+    *c = *a;
+    bit::shift_left(*c, n);
+    ref = ref_a;
+    std::fill(std::shift_left(ref.begin(), ref.end(), n), ref.end(), false);
+    EXPECT_TRUE(matches(*c, ref)) << "shift_left " << n;
+    *c = *a;
+    bit::shift_right(*c, n);
+    ref = ref_a;
+    std::fill(ref.begin(), std::shift_right(ref.begin(), ref.end(), n), false);
+    EXPECT_TRUE(matches(*c, ref)) << "shift_right " << n;
+  }
+  c->fill(bit::bit0);
+  EXPECT_EQ(bit::count(*c, bit::bit1), 0);
+  EXPECT_EQ(bit::find(*c, bit::bit1), c->end());
+}
+
+TEST(ArrayTest, FixedKernelsConstexpr) {
+  constexpr auto shifted = [] {
+    bit::bit_array<70, uint64_t> a;
+    a.fill(bit::bit1);
+    bit::shift_left(a, 3);
+    return a;
+  }();
+  static_assert(bit::count(shifted, bit::bit1) == 67);
+  static_assert(bit::find(shifted, bit::bit0) - shifted.begin() == 67);
+  static_assert(shifted == bit::bit_array<70, uint64_t>(~~shifted));
+}
@@ -0,0 +1,124 @@
+// ========================== ATOMIC BIT ARRAY TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for atomic_bit_array
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template <typename WordType>
+class AtomicArrayTest : public testing::Test {};
+
+using AtomicWordTypes = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(AtomicArrayTest, AtomicWordTypes);
+
+TYPED_TEST(AtomicArrayTest, SingleThread) {
+  bit::atomic_bit_array<TypeParam> bits(203);
+  EXPECT_EQ(bits.size(), 203);
+  EXPECT_EQ(bits.count(bit::bit1), 0);
+  EXPECT_EQ(bits.find(bit::bit1), bits.size());
+  EXPECT_EQ(bits.find(bit::bit0), 0);
+
+  EXPECT_EQ(bits[77].test_and_set(), bit::bit0);
+  EXPECT_EQ(bits[77].test_and_set(), bit::bit1);
+  EXPECT_EQ(bits[77], bit::bit1);
+  EXPECT_EQ(bits.find(bit::bit1), 77);
+
+  bits[202] = bit::bit1;
+  EXPECT_EQ(bits.load(202), bit::bit1);
+  EXPECT_EQ(bits.count(bit::bit1), 2);
+  EXPECT_EQ(bits.count(bit::bit0), 201);
+
+  EXPECT_EQ(bits[202].fetch_and(bit::bit0), bit::bit1);
+  EXPECT_EQ(bits[202].load(), bit::bit0);
+  EXPECT_EQ(bits[5].fetch_or(bit::bit1), bit::bit0);
+  EXPECT_EQ(bits[5].flip(), bit::bit1);
+  EXPECT_EQ(bits[5].load(), bit::bit0);
+  EXPECT_EQ(bits[77].test_and_reset(), bit::bit1);
+  EXPECT_EQ(bits.count(bit::bit1), 0);
+
+  // Bits past the end of the last word are ignored
+  bits.fill(bit::bit1);
+  EXPECT_EQ(bits.count(bit::bit1), 203);
+  EXPECT_EQ(bits.find(bit::bit0), bits.size());
+  bits[100] = bit::bit0;
+  EXPECT_EQ(bits.find(bit::bit0), 100);
+}
+
+TYPED_TEST(AtomicArrayTest, IdentityOperandsWithReleaseOrders) {
+  bit::atomic_bit_array<TypeParam> bits(70);
+  bits[3] = bit::bit1;
+  for (std::memory_order order : {std::memory_order_release, std::memory_order_acq_rel}) {
+    for (size_t pos : {size_t{3}, size_t{4}}) {
+      const bit::bit_value expected = (pos == 3) ? bit::bit1 : bit::bit0;
+      EXPECT_EQ(bits[pos].fetch_or(bit::bit0, order), expected);
+      EXPECT_EQ(bits[pos].fetch_and(bit::bit1, order), expected);
+      EXPECT_EQ(bits[pos].fetch_xor(bit::bit0, order), expected);
+      EXPECT_EQ(bits[pos].load(), expected);
+    }
+    EXPECT_EQ(bits.count(bit::bit1), 1);
+  }
+}
+
+TYPED_TEST(AtomicArrayTest, ConcurrentTestAndSet) {
+  constexpr size_t size = 10007;
+  constexpr size_t threads = 8;
+  bit::atomic_bit_array<TypeParam> visited(size);
+  std::atomic<size_t> first_visits{0};
+
+  // Every thread visits every node, in a different order, sharing words
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&visited, &first_visits, t] {
+      size_t local = 0;
+      for (size_t i = 0; i < size; ++i) {
+        const size_t node = (i * 7 + t * 131) % size;
+        if (visited[node].test_and_set(std::memory_order_relaxed) == bit::bit0) {
+          ++local;
+        }
+      }
+      first_visits += local;
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  EXPECT_EQ(first_visits, size);
+  EXPECT_EQ(visited.count(bit::bit1), size);
+}
+
+TYPED_TEST(AtomicArrayTest, ConcurrentSetAndReset) {
+  constexpr size_t size = 4096;
+  bit::atomic_bit_array<TypeParam> bits(size);
+
+  // Even bits are set by one thread while odd bits are set then cleared by another
+  std::thread setter([&bits] {
+    for (size_t i = 0; i < size; i += 2) {
+      bits[i] = bit::bit1;
+    }
+  });
+  std::thread toggler([&bits] {
+    for (size_t i = 1; i < size; i += 2) {
+      bits[i] = bit::bit1;
+      bits[i] = bit::bit0;
+    }
+  });
+  setter.join();
+  toggler.join();
+  EXPECT_EQ(bits.count(bit::bit1), size / 2);
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(bits[i], (i % 2) ? bit::bit0 : bit::bit1);
+  }
+}
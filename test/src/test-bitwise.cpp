@@ -4,7 +4,9 @@
 
 #include "bitlib/bit-containers/bit_array.hpp"
 #include "bitlib/bit-containers/bit_array_dynamic_extent.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
 #include "fixtures.hpp"
+#include "test_utils.hpp"
 
 // Third-party libraries
 #include "gtest/gtest.h"
@@ -44,3 +46,78 @@ TEST(Bitwise, Xor) {
   num ^= num2;
   EXPECT_EQ(xord, num);
 }
+
+TEST(Bitwise, FusedExpression) {
+  for (size_t n : {64 * 20, 1000}) {
+    bit::bit_array<std::dynamic_extent, uint64_t> random(get_random_bvec<uint64_t>(3 * n));
+    const auto a = random(0, n);
+    const auto b = random(n, 2 * n);
+    const auto c = random(2 * n, 3 * n);
+
+    bit::bit_array<std::dynamic_extent, uint64_t> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+      expected[i] = (a[i] & b[i]) | ~c[i];
+    }
+
+    // Eager operators
+    EXPECT_EQ((a & b) | ~c, expected);
+
+    bit::bit_array<std::dynamic_extent, uint64_t> result = (bit::lazy(a) & b) | ~bit::lazy(c);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ((bit::lazy(a) & b) | ~bit::lazy(c), expected);
+    EXPECT_EQ(expected, (bit::lazy(a) & b) | ~bit::lazy(c));
+
+    bit::bit_vector<uint64_t> vec;
+    vec.assign_range((bit::lazy(a) & b) | ~bit::lazy(c));
+    EXPECT_EQ(vec, expected);
+    EXPECT_EQ(vec ^ vec, bit::bit_vector<uint64_t>(n, bit::bit0));
+
+    // Unaligned destination
+    bit::bit_array<std::dynamic_extent, uint64_t> wide(n + 10, bit::bit0);
+    wide(3, n + 3) = (bit::lazy(a) & b) | ~bit::lazy(c);
+    EXPECT_EQ(wide(3, n + 3), expected);
+    EXPECT_EQ(bit::count(wide.begin(), wide.end(), bit::bit1),
+              bit::count(expected.begin(), expected.end(), bit::bit1));
+
+    result = a;
+    result |= bit::lazy(b) ^ c;
+    for (size_t i = 0; i < n; ++i) {
+      expected[i] = a[i] | (b[i] ^ c[i]);
+    }
+    EXPECT_EQ(result, expected);
+  }
+}
+
+TEST(Bitwise, ExpressionReductions) {
+  constexpr size_t n = 777;
+  bit::bit_array<std::dynamic_extent, uint64_t> random(get_random_bvec<uint64_t>(2 * n));
+  const auto a = random(0, n);
+  const auto b = random(n, 2 * n);
+
+  const auto expression = bit::lazy(a) ^ b;
+  size_t ones = 0;
+  size_t first_one = n;
+  size_t first_zero = n;
+  for (size_t i = 0; i < n; ++i) {
+    const bool bit = a[i] != b[i];
+    ones += bit;
+    if (bit && first_one == n) {
+      first_one = i;
+    }
+    if (!bit && first_zero == n) {
+      first_zero = i;
+    }
+  }
+  EXPECT_EQ(bit::count(expression.begin(), expression.end(), bit::bit1), ones);
+  EXPECT_EQ(bit::count(expression.begin() + 5, expression.end() - 3, bit::bit0),
+            (n - 8) - bit::count(expression.begin() + 5, expression.end() - 3, bit::bit1));
+  EXPECT_EQ(bit::find(expression.begin(), expression.end(), bit::bit1) - expression.begin(), first_one);
+  EXPECT_EQ(bit::find(expression.begin(), expression.end(), bit::bit0) - expression.begin(), first_zero);
+  const auto zeros = bit::lazy(a) ^ a;
+  EXPECT_EQ(bit::find(zeros.begin(), zeros.end(), bit::bit1), zeros.end());
+  EXPECT_TRUE((bit::lazy(a) ^ b) == (bit::lazy(b) ^ a));
+  EXPECT_FALSE((bit::lazy(a) ^ b) == (bit::lazy(a) & b));
+  // Eager results own their bits
+  auto owned = a ^ b;
+  EXPECT_TRUE(owned == expression);
+}
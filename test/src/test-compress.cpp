@@ -0,0 +1,108 @@
+// ============================= COMPRESS TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for compress, expand and the pext/pdep helpers
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+static_assert(bit::_pext<uint8_t>(0b10110110, 0b11110000) == 0b1011);
+static_assert(bit::_pdep<uint8_t>(0b1011, 0b11110000) == 0b10110000);
+static_assert(bit::_pext<uint64_t>(0x123456789ABCDEF0ull, ~0ull) == 0x123456789ABCDEF0ull);
+
+TEST(Compress, PextPdep) {
+  std::mt19937_64 gen(11);
+  for (int i = 0; i < 1000; ++i) {
+    const uint64_t src = gen();
+    const uint64_t msk = gen() & gen();
+    uint64_t extracted = 0;
+    uint64_t deposited = 0;
+    for (int b = 0, k = 0; b < 64; ++b) {
+      if ((msk >> b) & 1) {
+        extracted |= ((src >> b) & 1) << k;
+        deposited |= ((src >> k) & 1) << b;
+        ++k;
+      }
+    }
+    EXPECT_EQ(bit::_pext(src, msk), extracted);
+    EXPECT_EQ(bit::_pdep(src, msk), deposited);
+    EXPECT_EQ(bit::_pext<uint16_t>(src, msk), bit::_pext<uint64_t>(src & 0xFFFF, msk & 0xFFFF));
+    EXPECT_EQ(bit::_pdep<uint16_t>(src, msk), static_cast<uint16_t>(bit::_pdep<uint64_t>(src & 0xFFFF, msk & 0xFFFF)));
+  }
+}
+
+TYPED_TEST(DoubleRangeTest, Compress) {
+  using WordType = typename TestFixture::base_type;
+  constexpr auto digits = bit::binary_digits<WordType>::value;
+  for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+    bit::bit_vector<WordType>& src = this->random_bitvecs1[idx];
+    bit::bit_vector<WordType>& mask = this->random_bitvecs2[idx];
+    std::vector<bool>& boolsrc = this->random_boolvecs1[idx];
+    std::vector<bool>& boolmask = this->random_boolvecs2[idx];
+    const long long start1 = generate_random_number(0, std::min<long long>(src.size() - 1, digits + 1));
+    const long long start2 = generate_random_number(0, std::min<long long>(mask.size() - 1, digits + 1));
+    const long long length = std::min<long long>(src.size() - start1, mask.size() - start2);
+    const long long d_start = generate_random_number(0, digits + 1);
+
+    std::vector<bool> expected;
+    for (long long i = 0; i < length; ++i) {
+      if (boolmask[start2 + i]) {
+        expected.push_back(boolsrc[start1 + i]);
+      }
+    }
+    bit::bit_vector<WordType> out(d_start + length + digits, bit::bit1);
+    const auto d_first = out.begin() + d_start;
+    const auto d_last = bit::compress(src.begin() + start1, src.begin() + start1 + length, mask.begin() + start2, d_first);
+    ASSERT_EQ(d_last - d_first, static_cast<long long>(expected.size()));
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(static_cast<bool>(d_first[i]), expected[i]) << "at " << i;
+    }
+    // Bits around the output are untouched
+    EXPECT_EQ(bit::count(out.begin(), d_first, bit::bit1), d_start);
+    EXPECT_EQ(bit::count(d_last, out.end(), bit::bit0), 0);
+
+    // expand is the inverse on the selected positions
+    bit::bit_vector<WordType> back(d_start + length, bit::bit1);
+    const auto e_last = bit::expand(mask.begin() + start2, mask.begin() + start2 + length, d_first, back.begin() + d_start);
+    ASSERT_EQ(e_last, back.end());
+    for (long long i = 0; i < length; ++i) {
+      ASSERT_EQ(static_cast<bool>(back[d_start + i]), boolmask[start2 + i] && boolsrc[start1 + i]) << "at " << i;
+    }
+    EXPECT_EQ(bit::count(back.begin(), back.begin() + d_start, bit::bit1), d_start);
+  }
+}
+
+TEST(Compress, Column) {
+  // 8 records of 12 bits; extract the 4 bit field at offset 5
+  bit::bit_vector<uint64_t> records(8 * 12);
+  bit::bit_vector<uint64_t> mask(8 * 12);
+  for (size_t r = 0; r < 8; ++r) {
+    for (size_t b = 0; b < 4; ++b) {
+      records[r * 12 + 5 + b] = ((r >> b) & 1) ? bit::bit1 : bit::bit0;
+      mask[r * 12 + 5 + b] = bit::bit1;
+    }
+  }
+  bit::bit_vector<uint64_t> column(32);
+  EXPECT_EQ(bit::compress(records.begin(), records.end(), mask.begin(), column.begin()), column.end());
+  for (size_t r = 0; r < 8; ++r) {
+    size_t value = 0;
+    for (size_t b = 0; b < 4; ++b) {
+      value |= static_cast<size_t>(static_cast<bool>(column[r * 4 + b])) << b;
+    }
+    EXPECT_EQ(value, r);
+  }
+}
@@ -72,6 +72,39 @@ TYPED_TEST(DoubleRangeTest, Copy) {
     }
 }
 
+TYPED_TEST(DoubleRangeTest, CopyStorePolicy) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+        bit::bit_vector<WordType>& bitvec1 = this->random_bitvecs1[idx];
+        bit::bit_vector<WordType>& bitvec2 = this->random_bitvecs2[idx];
+        std::vector<bool>& boolvec1 = this->random_boolvecs1[idx];
+        std::vector<bool>& boolvec2 = this->random_boolvecs2[idx];
+        const long long start1 = generate_random_number(0, std::min<long long>(bitvec1.size() - 1, digits + 1));
+        // Same position in both ranges, so whole words take the streaming path
+        const long long start2 = (start1 % digits) + digits * generate_random_number(0, 1);
+        const long long length = std::max<long long>(0, std::min<long long>(bitvec1.size() - start1, bitvec2.size() - start2));
+
+        auto bitret = bit::copy(
+            bit::policy::streaming,
+            bitvec1.begin() + start1,
+            bitvec1.begin() + start1 + length,
+            bitvec2.begin() + start2);
+        std::copy(
+            boolvec1.begin() + start1,
+            boolvec1.begin() + start1 + length,
+            boolvec2.begin() + start2);
+        EXPECT_EQ(bit::distance(bitvec2.begin(), bitret), start2 + length);
+        EXPECT_TRUE(std::equal(
+                    bitvec2.begin(), bitvec2.end(),
+                    boolvec2.begin(), boolvec2.end(), comparator)
+        );
+        bit::bit_vector<WordType> cached(bitvec2.size());
+        bit::copy(bit::policy::cached, bitvec2.begin(), bitvec2.end(), cached.begin());
+        EXPECT_EQ(cached, bitvec2);
+    }
+}
+
 TYPED_TEST(MixedDoubleRangeTest, Copy) {
   for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
     bit::bit_vector<typename TestFixture::FromWordType>& bitvec1 = this->random_bitvecs1[idx];
@@ -35,4 +35,23 @@ TYPED_TEST(SingleRangeTest, Count) {
   }
 }
 
-
+TYPED_TEST(SingleRangeTest, CountLong) {
+  // Spans many SIMD blocks so the bulk kernel and its remainder are exercised
+  using WordType = typename TestFixture::base_type;
+  constexpr size_t digits = bit::binary_digits<WordType>::value;
+  const size_t word_count = 4096 / sizeof(WordType) + 3;
+  std::vector<WordType> words = get_random_vec<WordType>(word_count);
+  bit::bit_vector<WordType> bitvec(word_count * digits);
+  std::copy(words.begin(), words.end(), bitvec.begin().base());
+  std::vector<bool> boolvec = boolvec_from_bitvec(bitvec);
+  for (size_t start : {size_t{0}, size_t{1}, digits - 1, digits + 3}) {
+    for (size_t end_off : {size_t{0}, size_t{1}, digits + 5}) {
+      auto bitret = bit::count(bitvec.begin() + start, bitvec.end() - end_off, bit::bit1);
+      auto boolret = std::count(boolvec.begin() + start, boolvec.end() - end_off, true);
+      EXPECT_EQ(bitret, boolret);
+      bitret = bit::count(bitvec.begin() + start, bitvec.end() - end_off, bit::bit0);
+      boolret = std::count(boolvec.begin() + start, boolvec.end() - end_off, false);
+      EXPECT_EQ(bitret, boolret);
+    }
+  }
+}
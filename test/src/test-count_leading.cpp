@@ -16,3 +16,13 @@ TEST(CountLeading, CountLeadingZeroes) {
   std::cout << "Count leading zeroes: " << clz << std::endl;
   EXPECT_EQ(clz, 128);
 }
+
+TEST(CountLeading, CountLeadingZeroesPartialWord) {
+  for (size_t size : {129, 130, 136, 200}) {
+    auto num = bit::bit_array<>(size, bit::bit0);
+    num[0] = bit::bit1;
+    EXPECT_EQ(bit::count_msb(num.begin(), num.end(), bit::bit0), static_cast<int>(size - 1));
+    num[size - 3] = bit::bit1;
+    EXPECT_EQ(bit::count_msb(num.begin(), num.end(), bit::bit0), 2);
+  }
+}
@@ -0,0 +1,127 @@
+// ============================ EXECUTION TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the execution policy overloads
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <execution>
+#include <functional>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template <typename WordType>
+class ExecutionTest : public testing::Test {
+ protected:
+  using base_type = WordType;
+  static constexpr size_t digits = bit::binary_digits<WordType>::value;
+  // Large enough to be split into several chunks
+  static constexpr size_t size = 5 * bit::_parallel_min_chunk_words * digits + 77;
+
+  bit::bit_vector<WordType> bitvec1;
+  bit::bit_vector<WordType> bitvec2;
+  std::vector<bool> boolvec1;
+  std::vector<bool> boolvec2;
+
+  void SetUp() override {
+    bitvec1 = get_random_bvec<WordType>(size);
+    bitvec2 = get_random_bvec<WordType>(size);
+    boolvec1 = boolvec_from_bitvec(bitvec1);
+    boolvec2 = boolvec_from_bitvec(bitvec2);
+  }
+};
+TYPED_TEST_SUITE(ExecutionTest, BaseTypes);
+
+TYPED_TEST(ExecutionTest, Count) {
+  auto& bitvec = this->bitvec1;
+  auto& boolvec = this->boolvec1;
+  for (size_t start : {0, 3}) {
+    EXPECT_EQ(
+        bit::count(std::execution::par, bitvec.begin() + start, bitvec.end() - 5, bit::bit1),
+        std::count(boolvec.begin() + start, boolvec.end() - 5, true));
+    EXPECT_EQ(
+        bit::count(std::execution::par_unseq, bitvec.begin() + start, bitvec.end(), bit::bit0),
+        std::count(boolvec.begin() + start, boolvec.end(), false));
+  }
+}
+
+TYPED_TEST(ExecutionTest, Find) {
+  auto& bitvec = this->bitvec1;
+  bit::fill(bitvec.begin(), bitvec.end(), bit::bit0);
+  EXPECT_EQ(bit::find(std::execution::par, bitvec.begin() + 3, bitvec.end(), bit::bit1), bitvec.end());
+  for (size_t pos : {size_t{5}, this->size / 2, this->size - 1}) {
+    bitvec[pos] = bit::bit1;
+    EXPECT_EQ(bit::find(std::execution::par, bitvec.begin() + 3, bitvec.end(), bit::bit1), bitvec.begin() + pos);
+    EXPECT_EQ(
+        bit::find(std::execution::par, bitvec.begin() + 3, bitvec.end(), bit::bit0),
+        bitvec.begin() + 3);
+    bitvec[pos] = bit::bit0;
+  }
+}
+
+TYPED_TEST(ExecutionTest, FindLast) {
+  auto& bitvec = this->bitvec1;
+  bit::fill(bitvec.begin(), bitvec.end(), bit::bit0);
+  EXPECT_EQ(bit::find_last(std::execution::par, bitvec.begin() + 3, bitvec.end() - 2, bit::bit1), bitvec.end() - 2);
+  for (size_t pos : {size_t{5}, this->size / 2, this->size - 3}) {
+    bitvec[pos] = bit::bit1;
+    bitvec[4] = bit::bit1;
+    EXPECT_EQ(bit::find_last(std::execution::par, bitvec.begin() + 3, bitvec.end() - 2, bit::bit1), bitvec.begin() + pos);
+    EXPECT_EQ(
+        bit::find_last(std::execution::par, bitvec.begin() + 3, bitvec.end() - 2, bit::bit0),
+        bitvec.end() - ((pos == this->size - 3) ? 4 : 3));
+    bitvec[pos] = bit::bit0;
+    bitvec[4] = bit::bit0;
+  }
+}
+
+TYPED_TEST(ExecutionTest, Equal) {
+  auto& bitvec = this->bitvec1;
+  bit::bit_vector<typename TestFixture::base_type> other = bitvec;
+  EXPECT_TRUE(bit::equal(std::execution::par, bitvec.begin() + 3, bitvec.end(), other.begin() + 3));
+  other[this->size - 2] = ~other[this->size - 2];
+  EXPECT_FALSE(bit::equal(std::execution::par, bitvec.begin() + 3, bitvec.end(), other.begin() + 3));
+  EXPECT_TRUE(bit::equal(std::execution::par, bitvec.begin(), bitvec.end() - 2, other.begin()));
+}
+
+TYPED_TEST(ExecutionTest, Fill) {
+  auto& bitvec = this->bitvec1;
+  auto& boolvec = this->boolvec1;
+  bit::fill(std::execution::par, bitvec.begin() + 3, bitvec.end() - 5, bit::bit1);
+  std::fill(boolvec.begin() + 3, boolvec.end() - 5, true);
+  EXPECT_TRUE(std::equal(bitvec.begin(), bitvec.end(), boolvec.begin(), boolvec.end(), comparator));
+}
+
+TYPED_TEST(ExecutionTest, Copy) {
+  auto& src = this->bitvec1;
+  auto& dst = this->bitvec2;
+  auto bitret = bit::copy(std::execution::par, src.begin() + 3, src.end() - 7, dst.begin() + 5);
+  auto boolret = std::copy(this->boolvec1.begin() + 3, this->boolvec1.end() - 7, this->boolvec2.begin() + 5);
+  EXPECT_EQ(bit::distance(dst.begin(), bitret), std::distance(this->boolvec2.begin(), boolret));
+  EXPECT_TRUE(std::equal(dst.begin(), dst.end(), this->boolvec2.begin(), this->boolvec2.end(), comparator));
+}
+
+TYPED_TEST(ExecutionTest, Transform) {
+  using WordType = typename TestFixture::base_type;
+  auto& lhs = this->bitvec1;
+  auto& rhs = this->bitvec2;
+  bit::bit_vector<WordType> expected(this->size);
+  bit::bit_vector<WordType> result(this->size);
+
+  bit::transform(lhs.begin() + 3, lhs.end(), expected.begin() + 1, [](WordType a) -> WordType { return ~a; });
+  bit::transform(std::execution::par, lhs.begin() + 3, lhs.end(), result.begin() + 1, [](WordType a) -> WordType { return ~a; });
+  EXPECT_EQ(result, expected);
+
+  bit::transform(lhs.begin() + 3, lhs.end(), rhs.begin() + 3, expected.begin() + 1, std::bit_xor<WordType>());
+  bit::transform(std::execution::par, lhs.begin() + 3, lhs.end(), rhs.begin() + 3, result.begin() + 1, std::bit_xor<WordType>());
+  EXPECT_EQ(result, expected);
+}
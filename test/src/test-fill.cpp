@@ -57,3 +57,25 @@ TYPED_TEST(SingleRangeTest, Fill) {
     }
 }
 
+TYPED_TEST(SingleRangeTest, FillStorePolicy) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+        bit::bit_vector<WordType>& bitvec = this->random_bitvecs[idx];
+        std::vector<bool>& boolvec = this->random_boolvecs[idx];
+        const long long start = generate_random_number(0, std::min<long long>(bitvec.size(), digits + 1));
+        const long long end = generate_random_number(0, std::min<long long>(digits + 1, bitvec.size() - start));
+        bit::fill(bit::policy::streaming, bitvec.begin() + start, bitvec.end() - end, bit::bit1);
+        std::fill(boolvec.begin() + start, boolvec.end() - end, true);
+        EXPECT_TRUE(std::equal(
+                    bitvec.begin(), bitvec.end(),
+                    boolvec.begin(), boolvec.end(), comparator)
+        );
+        bit::fill(bit::policy::cached, bitvec.begin() + end, bitvec.end() - start, bit::bit0);
+        std::fill(boolvec.begin() + end, boolvec.end() - start, false);
+        EXPECT_TRUE(std::equal(
+                    bitvec.begin(), bitvec.end(),
+                    boolvec.begin(), boolvec.end(), comparator)
+        );
+    }
+}
@@ -36,4 +36,38 @@ TYPED_TEST(SingleRangeTest, Find) {
     }
 }
 
+TYPED_TEST(SingleRangeTest, FindLast) {
+    for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+        bit::bit_vector<typename TestFixture::base_type>& bitvec = this->random_bitvecs[idx];
+        std::vector<bool>& boolvec = this->random_boolvecs[idx];
+        size_t start_count = 16;
+        while (start_count--) {
+            const long long start = generate_random_number(0, std::min<long long>(bitvec.size() - 1, 16));
+            const long long end = generate_random_number(start, bitvec.size());
+            for (bool value : {true, false}) {
+                const auto bitret = bit::find_last(
+                    bitvec.begin() + start, bitvec.begin() + end, value ? bit::bit1 : bit::bit0);
+                long long expected = end;
+                for (long long i = end - 1; i >= start; --i) {
+                    if (boolvec[i] == value) {
+                        expected = i;
+                        break;
+                    }
+                }
+                EXPECT_EQ(std::distance(bitvec.begin(), bitret), expected);
+            }
+        }
+    }
+}
 
+TEST(Find, SkipsEmptyCacheLines) {
+    bit::bit_vector<uint16_t> bitvec(5000);
+    EXPECT_EQ(bit::find(bitvec.begin() + 1, bitvec.end() - 1, bit::bit1), bitvec.end() - 1);
+    EXPECT_EQ(bit::find_last(bitvec.begin() + 1, bitvec.end() - 1, bit::bit1), bitvec.end() - 1);
+    for (size_t pos : {1, 15, 16, 511, 512, 1024, 4097, 4998}) {
+        bitvec[pos] = bit::bit1;
+        EXPECT_EQ(bit::find(bitvec.begin() + 1, bitvec.end() - 1, bit::bit1), bitvec.begin() + pos);
+        EXPECT_EQ(bit::find_last(bitvec.begin() + 1, bitvec.end() - 1, bit::bit1), bitvec.begin() + pos);
+        bitvec[pos] = bit::bit0;
+    }
+}
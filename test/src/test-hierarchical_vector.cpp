@@ -0,0 +1,126 @@
+// ====================== HIERARCHICAL BIT VECTOR TESTS ===================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for hierarchical_bit_vector
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstdint>
+#include <random>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template <typename WordType>
+class HierarchicalVectorTest : public testing::Test {};
+
+using HierarchicalWordTypes = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(HierarchicalVectorTest, HierarchicalWordTypes);
+
+TYPED_TEST(HierarchicalVectorTest, SetReset) {
+  bit::hierarchical_bit_vector<TypeParam> bits(5000);
+  EXPECT_EQ(bits.size(), 5000);
+  EXPECT_EQ(bits.count(), 0);
+  EXPECT_EQ(bits.find_next(0), bits.size());
+  EXPECT_EQ(bits.find_prev(4999), bits.size());
+  EXPECT_EQ(bits.begin(), bits.end());
+
+  bits.set(4321);
+  bits.set(17);
+  bits.set(17);
+  EXPECT_EQ(bits.count(), 2);
+  EXPECT_EQ(bits[17], bit::bit1);
+  EXPECT_EQ(bits.find_next(0), 17);
+  EXPECT_EQ(bits.find_next(17), 17);
+  EXPECT_EQ(bits.find_next(18), 4321);
+  EXPECT_EQ(bits.find_next(4322), bits.size());
+  EXPECT_EQ(bits.find_prev(4999), 4321);
+  EXPECT_EQ(bits.find_prev(4320), 17);
+  EXPECT_EQ(bits.find_prev(16), bits.size());
+  EXPECT_EQ(bits.find_prev(bits.size() + 100), 4321);
+
+  bits.reset(4321);
+  bits.reset(4321);
+  EXPECT_EQ(bits.count(), 1);
+  EXPECT_EQ(bits.find_next(18), bits.size());
+  EXPECT_EQ(bits.find_prev(4999), 17);
+  bits.set(17, bit::bit0);
+  EXPECT_EQ(bits.count(bit::bit0), 5000);
+  EXPECT_EQ(bits.find(), bits.size());
+
+  // Padding bits past the end stay clear
+  bits.fill(bit::bit1);
+  EXPECT_EQ(bits.count(), 5000);
+  EXPECT_EQ(bits.find_prev(bits.size()), 4999);
+  EXPECT_EQ(bits.find(bit::bit0), bits.size());
+  bits.reset(100);
+  EXPECT_EQ(bits.find(bit::bit0), 100);
+  bits.clear();
+  EXPECT_EQ(bits.find_next(0), bits.size());
+}
+
+TYPED_TEST(HierarchicalVectorTest, Depth) {
+  constexpr size_t digits = bit::binary_digits<TypeParam>::value;
+  EXPECT_EQ(bit::hierarchical_bit_vector<TypeParam>().depth(), 0);
+  EXPECT_EQ(bit::hierarchical_bit_vector<TypeParam>(digits).depth(), 1);
+  EXPECT_EQ(bit::hierarchical_bit_vector<TypeParam>(digits + 1).depth(), 2);
+  EXPECT_EQ(bit::hierarchical_bit_vector<TypeParam>(digits * digits).depth(), 2);
+  EXPECT_EQ(bit::hierarchical_bit_vector<TypeParam>(digits * digits * digits + 1).depth(), 4);
+
+  bit::hierarchical_bit_vector<TypeParam> one(1);
+  EXPECT_EQ(one.find_next(0), 1);
+  one.set(0);
+  EXPECT_EQ(one.find_next(0), 0);
+  EXPECT_EQ(one.find_prev(0), 0);
+}
+
+TYPED_TEST(HierarchicalVectorTest, Random) {
+  std::mt19937 gen(7);
+  for (size_t size : {1u, 63u, 64u, 65u, 700u, 4096u, 70000u}) {
+    bit::hierarchical_bit_vector<TypeParam> bits(size);
+    std::vector<bool> ref(size);
+    std::uniform_int_distribution<size_t> position(0, size - 1);
+    for (int op = 0; op < 2000; ++op) {
+      const size_t pos = position(gen);
+      if (gen() % 3) {
+        bits.set(pos);
+        ref[pos] = true;
+      } else {
+        bits.reset(pos);
+        ref[pos] = false;
+      }
+      const size_t from = position(gen);
+      size_t next = from;
+      while (next < size && !ref[next]) {
+        ++next;
+      }
+      ASSERT_EQ(bits.find_next(from), next);
+      size_t prev = from + 1;
+      while (prev > 0 && !ref[prev - 1]) {
+        --prev;
+      }
+      ASSERT_EQ(bits.find_prev(from), prev ? prev - 1 : size);
+    }
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < size; ++i) {
+      if (ref[i]) {
+        expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(std::vector<size_t>(bits.begin(), bits.end()), expected);
+    EXPECT_EQ(bits.count(), expected.size());
+
+    // Building from a bit range gives the same levels
+    bit::bit_vector<TypeParam> vec(size);
+    for (size_t pos : expected) {
+      vec[pos] = bit::bit1;
+    }
+    EXPECT_EQ(bit::hierarchical_bit_vector<TypeParam>(vec), bits);
+  }
+}
@@ -0,0 +1,106 @@
+// ========================= MAPPED BIT VECTOR TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the memory-mapped bit vector
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+class MappedVectorTest : public testing::Test {
+ protected:
+  std::filesystem::path path;
+
+  void SetUp() override {
+    const auto* info = testing::UnitTest::GetInstance()->current_test_info();
+    path = std::filesystem::temp_directory_path() / (std::string("bitlib-") + info->name() + ".bits");
+    std::filesystem::remove(path);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path);
+  }
+};
+
+TEST_F(MappedVectorTest, CreateWriteReopen) {
+  auto random = get_random_vec<uint64_t>(100);
+  {
+    bit::mapped_bit_vector<uint64_t> bits(path, 6000);
+    EXPECT_EQ(bits.size(), 6000);
+    EXPECT_EQ(bit::count(bits.begin(), bits.end(), bit::bit1), 0);
+    bit::copy(bit::bit_iterator<uint64_t*>(random.data()),
+              bit::bit_iterator<uint64_t*>(random.data()) + 6000,
+              bits.begin());
+    bits[17] = ~bits[17];
+    random[0] ^= uint64_t{1} << 17;
+    bits.sync();
+  }
+  EXPECT_EQ(std::filesystem::file_size(path), 94 * sizeof(uint64_t));
+
+  bit::mapped_bit_vector<const uint64_t> ro(path, 6000);
+  EXPECT_TRUE(bit::equal(ro.begin(), ro.end(), bit::bit_iterator<uint64_t*>(random.data())));
+  bit::mapped_bit_vector<const uint64_t> whole(path);
+  EXPECT_EQ(whole.size(), 94 * 64);
+  EXPECT_EQ(bit::count(whole.cbegin(), whole.cbegin() + 6000, bit::bit1),
+            bit::count(ro.begin(), ro.end(), bit::bit1));
+}
+
+TEST_F(MappedVectorTest, Resize) {
+  bit::mapped_bit_vector<uint32_t> bits(path, 0);
+  EXPECT_TRUE(bits.empty());
+  bits.resize(100, bit::bit1);
+  EXPECT_EQ(bit::count(bits.begin(), bits.end(), bit::bit1), 100);
+  bits.resize(70);
+  bits.resize(5000);
+  EXPECT_EQ(bit::count(bits.begin(), bits.end(), bit::bit1), 70);
+  EXPECT_EQ(bit::find(bits.begin(), bits.end(), bit::bit0) - bits.begin(), 70);
+  bits.resize(10);
+  EXPECT_EQ(std::filesystem::file_size(path), sizeof(uint32_t));
+  EXPECT_EQ(bit::count(bits.begin(), bits.end(), bit::bit1), 10);
+}
+
+TEST_F(MappedVectorTest, SpanAndAdvice) {
+  bit::mapped_bit_vector<uint8_t> bits(path, 1001);
+  bits.advise(bit::map_advice::sequential);
+  bits.advise(bit::map_advice::random);
+  bit::bit_span<uint8_t> span = bits.span();
+  EXPECT_EQ(span.size(), 1001);
+  bit::fill(span.begin() + 3, span.end() - 3, bit::bit1);
+  EXPECT_EQ(bit::count(bits.begin(), bits.end(), bit::bit1), 995);
+  EXPECT_EQ(bits.at(3), bit::bit1);
+  EXPECT_THROW(bits.at(1001), std::out_of_range);
+
+  const auto& cbits = bits;
+  static_assert(std::is_same_v<decltype(cbits.begin()), bit::mapped_bit_vector<uint8_t>::const_iterator>);
+  static_assert(std::is_same_v<decltype(cbits.span()), bit::bit_span<const uint8_t>>);
+  EXPECT_EQ(cbits[3], bit::bit1);
+  EXPECT_EQ(bit::count(cbits.begin(), cbits.end(), bit::bit1), 995);
+
+  bit::mapped_bit_vector<uint8_t> moved = std::move(bits);
+  EXPECT_FALSE(bits.is_open());
+  EXPECT_EQ(moved.size(), 1001);
+  EXPECT_EQ(moved[2], bit::bit0);
+}
+
+TEST_F(MappedVectorTest, Errors) {
+  EXPECT_THROW(bit::mapped_bit_vector<const uint64_t>{path}, std::system_error);
+  { std::ofstream(path) << "abcd"; }
+  EXPECT_THROW((bit::mapped_bit_vector<const uint64_t>{path, 64}), std::invalid_argument);
+  bit::mapped_bit_vector<const uint16_t> ro(path, 20);
+  EXPECT_EQ(ro.size(), 20);
+  EXPECT_EQ(ro.cbegin()[0], bit::bit1);  // 'a' = 0x61
+}
@@ -0,0 +1,141 @@
+// ============================== MATRIX TESTS ============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for bit_matrix
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template <typename WordType>
+class MatrixTest : public testing::Test {
+ protected:
+  std::mt19937 gen{42};
+
+  bit::bit_matrix<WordType> random_matrix(size_t rows, size_t cols) {
+    bit::bit_matrix<WordType> m(rows, cols);
+    for (size_t r = 0; r < rows; ++r) {
+      for (size_t c = 0; c < cols; ++c) {
+        m(r, c) = (gen() & 1) ? bit::bit1 : bit::bit0;
+      }
+    }
+    return m;
+  }
+};
+
+using MatrixWordTypes = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(MatrixTest, MatrixWordTypes);
+
+TYPED_TEST(MatrixTest, Basics) {
+  bit::bit_matrix<TypeParam> m(5, 70, bit::bit1);
+  EXPECT_EQ(m.rows(), 5);
+  EXPECT_EQ(m.cols(), 70);
+  EXPECT_EQ(m.stride(), (70 + bit::bitsof<TypeParam>() - 1) / bit::bitsof<TypeParam>());
+  EXPECT_EQ(bit::count(m.row(3).begin(), m.row(3).end(), bit::bit1), 70);
+  m(2, 69) = bit::bit0;
+  EXPECT_EQ(m(2, 69), bit::bit0);
+  EXPECT_EQ(m.row(2)[69], bit::bit0);
+  m.add_row(1, 2);
+  EXPECT_EQ(bit::count(m.row(1).begin(), m.row(1).end(), bit::bit1), 1);
+  EXPECT_EQ(m(1, 69), bit::bit1);
+  m.swap_rows(1, 4);
+  EXPECT_EQ(m(4, 69), bit::bit1);
+  EXPECT_EQ(m(1, 0), bit::bit1);
+}
+
+TYPED_TEST(MatrixTest, Transpose) {
+  for (auto [rows, cols] : {std::pair<size_t, size_t>{1, 1}, {8, 8}, {64, 64}, {3, 130}, {130, 3}, {77, 91}}) {
+    const auto m = this->random_matrix(rows, cols);
+    const auto t = m.transpose();
+    ASSERT_EQ(t.rows(), cols);
+    ASSERT_EQ(t.cols(), rows);
+    for (size_t r = 0; r < rows; ++r) {
+      for (size_t c = 0; c < cols; ++c) {
+        ASSERT_EQ(t(c, r), m(r, c)) << rows << "x" << cols << " at " << r << "," << c;
+      }
+    }
+    EXPECT_EQ(t.transpose(), m);
+  }
+}
+
+TYPED_TEST(MatrixTest, Multiply) {
+  for (auto [n, k, p] : {std::tuple<size_t, size_t, size_t>{1, 1, 1}, {5, 9, 3}, {40, 100, 70}, {64, 64, 64}}) {
+    const auto a = this->random_matrix(n, k);
+    const auto b = this->random_matrix(k, p);
+    const auto c = a * b;
+    ASSERT_EQ(c.rows(), n);
+    ASSERT_EQ(c.cols(), p);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < p; ++j) {
+        bool sum = false;
+        for (size_t x = 0; x < k; ++x) {
+          sum ^= static_cast<bool>(a(i, x)) && static_cast<bool>(b(x, j));
+        }
+        ASSERT_EQ(static_cast<bool>(c(i, j)), sum);
+      }
+    }
+    EXPECT_EQ(a * bit::bit_matrix<TypeParam>::identity(k), a);
+
+    bit::bit_vector<TypeParam> x(k);
+    for (size_t i = 0; i < k; ++i) {
+      x[i] = (this->gen() & 1) ? bit::bit1 : bit::bit0;
+    }
+    const auto y = a.multiply(x);
+    ASSERT_EQ(y.size(), n);
+    bit::bit_matrix<TypeParam> column(k, 1);
+    for (size_t i = 0; i < k; ++i) {
+      column(i, 0) = x[i];
+    }
+    const auto expected = a * column;
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(y.begin()[i], expected(i, 0));
+    }
+  }
+  EXPECT_THROW(this->random_matrix(3, 4) * this->random_matrix(5, 3), std::invalid_argument);
+}
+
+TYPED_TEST(MatrixTest, RowReduce) {
+  auto m = this->random_matrix(20, 50);
+  // Make rows 10.. dependent on the first rows
+  for (size_t r = 10; r < 20; ++r) {
+    bit::fill(m.row(r).begin(), m.row(r).end(), bit::bit0);
+    m.add_row(r, r - 10);
+    m.add_row(r, (r - 9) % 10);
+  }
+  const size_t rank = m.rank();
+  EXPECT_LE(rank, 10);
+
+  auto reduced = m;
+  EXPECT_EQ(reduced.row_reduce(), rank);
+  // Reduced row echelon form: each pivot is the only one in its column
+  size_t last_pivot = 0;
+  for (size_t r = 0; r < reduced.rows(); ++r) {
+    const auto row = reduced.row(r);
+    const size_t pivot = bit::find(row.begin(), row.end(), bit::bit1) - row.begin();
+    if (r >= rank) {
+      EXPECT_EQ(pivot, reduced.cols());
+      continue;
+    }
+    if (r > 0) {
+      EXPECT_GT(pivot, last_pivot);
+    }
+    last_pivot = pivot;
+    for (size_t i = 0; i < reduced.rows(); ++i) {
+      EXPECT_EQ(reduced(i, pivot), (i == r) ? bit::bit1 : bit::bit0);
+    }
+  }
+
+  EXPECT_EQ(bit::bit_matrix<TypeParam>::identity(33).rank(), 33);
+  EXPECT_EQ(bit::bit_matrix<TypeParam>(7, 9).rank(), 0);
+}
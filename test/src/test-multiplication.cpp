@@ -1,7 +1,9 @@
 #include <limits>
+#include <vector>
 
 #include "bitlib/bitlib.hpp"
 #include "gtest/gtest.h"
+#include "test_utils.hpp"
 
 TEST(BitMultiplication, Basic) {
   auto bits = 0xF'0F_b;
@@ -20,3 +22,76 @@ TEST(BitMultiplication, LowBits) {
   EXPECT_EQ(0, bit::multiplication(bits.begin(), bits.end(), 2'2_b));
   EXPECT_EQ(0xF'1E_b, bits);
 }
+
+TEST(BitMultiplication, Range) {
+  auto lhs = 0x10'FFFF_b;
+  auto rhs = 0x8'FF_b;
+  auto product = 0x18'0_b;
+  auto end = bit::multiplication(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), product.begin());
+  EXPECT_EQ(end, product.end());
+  EXPECT_EQ(0x18'FEFF01_b, product);
+}
+
+TEST(BitMultiplication, RangeRandom) {
+  // Compare against bit-serial shift-and-add over every width and alignment
+  auto lhs = get_random_bvec<uint8_t>(256);
+  auto rhs = get_random_bvec<uint8_t>(256);
+  for (size_t width1 = 1; width1 <= 200; width1 += 13) {
+    for (size_t width2 = 1; width2 <= 200; width2 += 11) {
+      bit::bit_vector<uint8_t> product(width1 + width2 + 4);
+      const auto first1 = lhs.begin() + 3;
+      const auto first2 = rhs.begin();
+      bit::multiplication(first1, first1 + width1, first2, first2 + width2, product.begin() + 1);
+      std::vector<bool> expected(width1 + width2);
+      for (size_t i = 0; i < width1; ++i) {
+        if (!static_cast<bool>(first1[i])) {
+          continue;
+        }
+        bool carry = false;
+        for (size_t j = i; j < width1 + width2; ++j) {
+          const bool b = (j - i < width2) && static_cast<bool>(first2[j - i]);
+          const bool p = expected[j];
+          expected[j] = p ^ b ^ carry;
+          carry = (p && b) || (carry && (p != b));
+        }
+      }
+      for (size_t i = 0; i < width1 + width2; ++i) {
+        ASSERT_EQ(static_cast<bool>(product[i + 1]), expected[i]) << width1 << "x" << width2 << " at " << i;
+      }
+      EXPECT_EQ(product[0], bit::bit0);
+    }
+  }
+}
+
+TEST(BitMultiplication, RangeKaratsuba) {
+  // Large enough operands take the Karatsuba path, unbalanced ones the slicing path
+  for (auto [n1, n2] : {std::pair<size_t, size_t>{8000, 8000}, {9001, 4099}, {20000, 3000}}) {
+    auto a = get_random_bvec<uint64_t>(n1);
+    auto b = get_random_bvec<uint64_t>(n2);
+    bit::bit_vector<uint64_t> ab(n1 + n2);
+    bit::bit_vector<uint64_t> ba(n1 + n2);
+    bit::multiplication(a.begin(), a.end(), b.begin(), b.end(), ab.begin());
+    bit::multiplication(b.begin(), b.end(), a.begin(), a.end(), ba.begin());
+    EXPECT_EQ(ab, ba);
+
+    // a * (b + 1) == a * b + a
+    bit::bit_vector<uint64_t> b1(b);
+    b1.push_back(bit::bit0);
+    bit::addition(b1.begin(), b1.end(), static_cast<uint64_t>(1));
+    bit::bit_vector<uint64_t> ab1(n1 + n2 + 1);
+    bit::multiplication(a.begin(), a.end(), b1.begin(), b1.end(), ab1.begin());
+    bit::bit_vector<uint64_t> expected(n1 + n2 + 1);
+    bit::bit_vector<uint64_t> a_wide(a);
+    a_wide.resize(n1 + n2 + 1);
+    ab.push_back(bit::bit0);
+    EXPECT_EQ(0, bit::addition(ab.begin(), ab.end(), a_wide.begin(), expected.begin()));
+    EXPECT_EQ(ab1, expected);
+
+    // Compare against the schoolbook kernel directly
+    const auto la = bit::detail::gather_limbs(a.begin(), n1);
+    const auto lb = bit::detail::gather_limbs(b.begin(), n2);
+    std::vector<uint64_t> school(la.size() + lb.size());
+    bit::detail::limbs_mul_schoolbook(la.data(), la.size(), lb.data(), lb.size(), school.data());
+    EXPECT_EQ(bit::detail::gather_limbs(ba.begin(), n1 + n2), std::vector<uint64_t>(school.begin(), school.begin() + (n1 + n2 + 63) / 64));
+  }
+}
@@ -0,0 +1,126 @@
+// ================================ PMR TESTS =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for dynamic bit arrays on std::pmr resources
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+namespace {
+
+class counting_resource : public std::pmr::memory_resource {
+ public:
+  size_t allocations = 0;
+  size_t live = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    live += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    live -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+using pmr_array = bit::bit_array<std::dynamic_extent, uint64_t, bit::policy::pmr<uint64_t>>;
+
+}  // namespace
+
+TEST(Pmr, DefaultResource) {
+  EXPECT_EQ(bit::pmr::get_default_resource(), std::pmr::get_default_resource());
+  counting_resource resource;
+  {
+    bit::pmr::resource_guard guard(&resource);
+    EXPECT_EQ(bit::pmr::get_default_resource(), &resource);
+    pmr_array a(1000, bit::bit1);
+    EXPECT_EQ(resource.allocations, 1);
+    EXPECT_EQ(bit::count(a.begin(), a.end(), bit::bit1), 1000);
+    // Arrays within the inline footprint never allocate
+    pmr_array small(64, bit::bit1);
+    EXPECT_EQ(resource.allocations, 1);
+  }
+  EXPECT_EQ(resource.live, 0);
+  EXPECT_EQ(bit::pmr::get_default_resource(), std::pmr::get_default_resource());
+}
+
+TEST(Pmr, ExpressionTemporariesUseArena) {
+  counting_resource upstream;
+  bit::pmr::arena<4096> arena(&upstream);
+  bit::pmr::resource_guard guard(&arena);
+
+  pmr_array a(1000, bit::bit0);
+  pmr_array b(1000, bit::bit0);
+  for (size_t i = 0; i < 1000; i += 3) {
+    a[i] = bit::bit1;
+  }
+  for (size_t i = 0; i < 1000; i += 2) {
+    b[i] = bit::bit1;
+  }
+  for (int round = 0; round < 8; ++round) {
+    pmr_array both = a & b;
+    pmr_array either = a | b;
+    EXPECT_EQ(bit::count(both.begin(), both.end(), bit::bit1), 167);
+    EXPECT_EQ(bit::count(either.begin(), either.end(), bit::bit1), 667);
+  }
+  EXPECT_EQ(upstream.allocations, 0);
+
+  // Past the inline buffer the arena takes blocks from upstream
+  for (int round = 0; round < 64; ++round) {
+    pmr_array temp = a ^ b;
+  }
+  EXPECT_GT(upstream.allocations, 0);
+  arena.release();
+  EXPECT_EQ(upstream.live, 0);
+}
+
+TEST(Pmr, CopyAndMoveAcrossResources) {
+  counting_resource first;
+  counting_resource second;
+  pmr_array a(500, bit::bit0, bit::pmr::allocator<uint64_t>(&first));
+  a[7] = bit::bit1;
+  a[499] = bit::bit1;
+  EXPECT_EQ(first.allocations, 1);
+
+  // Moves within a resource steal the buffer
+  pmr_array stolen(std::move(a), bit::pmr::allocator<uint64_t>(&first));
+  EXPECT_EQ(first.allocations, 1);
+  EXPECT_EQ(bit::count(stolen.begin(), stolen.end(), bit::bit1), 2);
+
+  // Moves across resources copy
+  pmr_array moved(std::move(stolen), bit::pmr::allocator<uint64_t>(&second));
+  EXPECT_EQ(second.allocations, 1);
+  EXPECT_EQ(bit::count(moved.begin(), moved.end(), bit::bit1), 2);
+
+  // Copies follow the thread's default resource
+  {
+    bit::pmr::resource_guard guard(&second);
+    pmr_array copy(moved);
+    EXPECT_EQ(second.allocations, 2);
+    EXPECT_EQ(copy, moved);
+  }
+
+  pmr_array target(500, bit::bit0, bit::pmr::allocator<uint64_t>(&first));
+  target = std::move(moved);
+  EXPECT_TRUE(target[7]);
+  EXPECT_TRUE(target[499]);
+  EXPECT_EQ(first.allocations, 2);
+  EXPECT_EQ(second.allocations, 2);
+}
@@ -0,0 +1,97 @@
+// =========================== RANK SELECT TESTS ============================ //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the rank/select index
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template <typename WordType>
+class RankSelectTest : public testing::Test {
+ protected:
+  using base_type = WordType;
+
+  // Checks every rank and select of [first, last) against a naive scan
+  template <typename It>
+  void check(bit::bit_iterator<It> first, bit::bit_iterator<It> last) {
+    bit::rank_select<It> index(first, last);
+    const size_t size = bit::distance(first, last);
+    ASSERT_EQ(index.size(), size);
+    std::vector<size_t> positions[2];
+    size_t ones = 0;
+    for (size_t pos = 0; pos < size; ++pos) {
+      ASSERT_EQ(index.rank(pos), ones);
+      ASSERT_EQ(index.rank(pos, bit::bit0), pos - ones);
+      const bool bit = static_cast<bool>(first[pos]);
+      positions[bit].push_back(pos);
+      ones += bit;
+    }
+    EXPECT_EQ(index.rank(size), ones);
+    EXPECT_EQ(index.count(bit::bit1), ones);
+    EXPECT_EQ(index.count(bit::bit0), size - ones);
+    for (size_t k = 0; k < positions[1].size(); ++k) {
+      ASSERT_EQ(index.select(k, bit::bit1), positions[1][k]);
+    }
+    for (size_t k = 0; k < positions[0].size(); ++k) {
+      ASSERT_EQ(index.select(k, bit::bit0), positions[0][k]);
+    }
+    EXPECT_EQ(index.select(positions[1].size(), bit::bit1), size);
+    EXPECT_EQ(index.select(positions[0].size(), bit::bit0), size);
+  }
+};
+TYPED_TEST_SUITE(RankSelectTest, BaseTypes);
+
+TYPED_TEST(RankSelectTest, Random) {
+  using WordType = typename TestFixture::base_type;
+  for (size_t size : {0, 1, 511, 512, 2048, 3 * 2048 + 77, 40000}) {
+    auto bitvec = get_random_bvec<WordType>(size);
+    this->check(bitvec.begin(), bitvec.end());
+  }
+}
+
+TYPED_TEST(RankSelectTest, Unaligned) {
+  using WordType = typename TestFixture::base_type;
+  auto bitvec = get_random_bvec<WordType>(20000);
+  this->check(bitvec.begin() + 3, bitvec.end() - 5);
+}
+
+TYPED_TEST(RankSelectTest, Uniform) {
+  using WordType = typename TestFixture::base_type;
+  // Long runs of a single value stress the select samples
+  bit::bit_vector<WordType> bitvec(3 * 8192 + 100, bit::bit1);
+  this->check(bitvec.begin(), bitvec.end());
+  bit::fill(bitvec.begin(), bitvec.end(), bit::bit0);
+  bitvec[17] = bit::bit1;
+  bitvec[3 * 8192 + 99] = bit::bit1;
+  this->check(bitvec.begin(), bitvec.end());
+}
+
+TEST(RankSelect, FromRange) {
+  bit::bit_vector<uint64_t> bitvec("0110100011110000");
+  bit::rank_select index(bitvec);
+  EXPECT_EQ(index.rank(4), 2);
+  EXPECT_EQ(index.select(4), 9);
+  EXPECT_EQ(index.select(0, bit::bit0), 0);
+
+  bit::bit_span<uint64_t> span(&*bitvec.begin().base(), bitvec.size());
+  bit::rank_select span_index(span);
+  EXPECT_EQ(span_index.rank(bitvec.size()), 7);
+
+  // The index keeps iterators into the range, so it must not bind a temporary container
+  using index_type = bit::rank_select<uint64_t*>;
+  static_assert(std::is_constructible_v<index_type, bit::bit_vector<uint64_t>&>);
+  static_assert(std::is_constructible_v<index_type, bit::bit_span<uint64_t>>);
+  static_assert(!std::is_constructible_v<index_type, bit::bit_vector<uint64_t>>);
+}
@@ -0,0 +1,238 @@
+// ========================== ROARING BITMAP TESTS ========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the compressed roaring bitmap
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+namespace {
+
+constexpr size_t chunk = size_t{1} << 16;
+
+// Chunks of every flavour: sparse, dense, runs, empty, sparse again and a
+// partial dense chunk at the end
+bit::bit_vector<uint64_t> mixed_bits(unsigned seed) {
+  std::mt19937 gen(seed);
+  bit::bit_vector<uint64_t> bits(5 * chunk + 1234);
+  for (size_t i = 0; i < 1000; ++i) {
+    bits[gen() % chunk] = bit::bit1;
+  }
+  for (size_t i = chunk; i < 2 * chunk; ++i) {
+    bits[i] = (gen() % 3) ? bit::bit1 : bit::bit0;
+  }
+  for (size_t run = 2 * chunk + gen() % 100; run < 3 * chunk; run += 500 + gen() % 500) {
+    std::fill(bits.begin() + run, bits.begin() + std::min(run + 300, 3 * chunk), bit::bit1);
+  }
+  for (size_t i = 0; i < 100; ++i) {
+    bits[4 * chunk + gen() % chunk] = bit::bit1;
+  }
+  for (size_t i = 5 * chunk; i < bits.size(); ++i) {
+    bits[i] = (gen() % 2) ? bit::bit1 : bit::bit0;
+  }
+  return bits;
+}
+
+void expect_matches(const bit::roaring_bitmap& roaring, const bit::bit_vector<uint64_t>& bits) {
+  ASSERT_EQ(roaring.size(), bits.size());
+  EXPECT_EQ(roaring.count(), bit::count(bits.begin(), bits.end(), bit::bit1));
+  EXPECT_EQ(roaring.count(bit::bit0), bit::count(bits.begin(), bits.end(), bit::bit0));
+  EXPECT_EQ(roaring.to_bit_vector(), bits);
+  std::vector<uint32_t> positions;
+  for (size_t i = 0; i < bits.size(); ++i) {
+    if (bits.begin()[i] == bit::bit1) {
+      positions.push_back(static_cast<uint32_t>(i));
+    }
+  }
+  EXPECT_TRUE(std::ranges::equal(roaring, positions));
+}
+
+}  // namespace
+
+TEST(RoaringBitmap, Empty) {
+  bit::roaring_bitmap roaring(1000);
+  EXPECT_TRUE(roaring.empty());
+  EXPECT_EQ(roaring.size(), 1000);
+  EXPECT_EQ(roaring.count(), 0);
+  EXPECT_EQ(roaring.count(bit::bit0), 1000);
+  EXPECT_EQ(roaring.find(), 1000);
+  EXPECT_EQ(roaring.find(bit::bit0), 0);
+  EXPECT_EQ(roaring.begin(), roaring.end());
+  EXPECT_EQ(roaring.to_bit_vector(), bit::bit_vector<uint64_t>(1000));
+}
+
+TEST(RoaringBitmap, RoundTrip) {
+  auto bits = mixed_bits(1);
+  bit::roaring_bitmap roaring(bits);
+  expect_matches(roaring, bits);
+  for (size_t pos : {size_t{0}, chunk - 1, chunk, 2 * chunk + 7, 4 * chunk + 1, bits.size() - 1}) {
+    EXPECT_EQ(roaring[pos], bits[pos]);
+  }
+}
+
+TEST(RoaringBitmap, RoundTripSpanAndWordTypes) {
+  auto bits = get_random_vec<uint8_t>(3 * chunk / 8);
+  bit::bit_span<uint8_t> span(bits.data(), 3 * chunk - 5);
+  bit::roaring_bitmap roaring(span);
+  ASSERT_EQ(roaring.size(), span.size());
+  EXPECT_EQ(roaring.count(), bit::count(span.begin(), span.end(), bit::bit1));
+
+  std::vector<uint8_t> out(bits.size(), 0xA5);
+  roaring.copy_to(bit::bit_iterator<uint8_t*>(out.data()));
+  bit::bit_span<uint8_t> out_span(out.data(), span.size());
+  EXPECT_TRUE(bit::equal(span.begin(), span.end(), out_span.begin()));
+  EXPECT_EQ(out.back(), bits.back() | (0xA5 & 0xE0));
+
+  const auto narrow = roaring.to_bit_vector<uint16_t>();
+  EXPECT_TRUE(bit::equal(span.begin(), span.end(), narrow.begin()));
+}
+
+TEST(RoaringBitmap, SetReset) {
+  bit::bit_vector<uint64_t> bits(3 * chunk);
+  bit::roaring_bitmap roaring(bits.size());
+  std::mt19937 gen(7);
+  // Grow chunk 1 past the array limit and back, chunk 2 stays sparse
+  for (size_t i = 0; i < 6000; ++i) {
+    const size_t pos = chunk + gen() % chunk;
+    bits[pos] = bit::bit1;
+    roaring.set(pos);
+  }
+  for (size_t i = 0; i < 50; ++i) {
+    const size_t pos = 2 * chunk + gen() % chunk;
+    bits[pos] = bit::bit1;
+    roaring.set(pos);
+  }
+  expect_matches(roaring, bits);
+  for (size_t pos = chunk; pos < 2 * chunk - 1000; ++pos) {
+    bits[pos] = bit::bit0;
+    roaring.reset(pos);
+  }
+  expect_matches(roaring, bits);
+  for (size_t pos = 0; pos < bits.size(); ++pos) {
+    roaring.reset(pos);
+  }
+  EXPECT_TRUE(roaring.empty());
+}
+
+TEST(RoaringBitmap, ModifyRuns) {
+  bit::bit_vector<uint64_t> bits(chunk);
+  std::fill(bits.begin() + 100, bits.begin() + 40000, bit::bit1);
+  bit::roaring_bitmap roaring(bits);
+  EXPECT_LT(roaring.memory_usage(), 128);
+  bits[50] = bit::bit1;
+  roaring.set(50);
+  bits[20000] = bit::bit0;
+  roaring.reset(20000);
+  expect_matches(roaring, bits);
+
+  // Split, shrink, extend and join runs in place
+  std::mt19937 gen(5);
+  for (size_t i = 0; i < 2000; ++i) {
+    const size_t pos = 90 + gen() % 40000;
+    const bit::bit_value value = (gen() % 2) ? bit::bit1 : bit::bit0;
+    bits[pos] = value;
+    roaring.set(pos, value);
+    ASSERT_EQ(roaring[pos], value);
+  }
+  expect_matches(roaring, bits);
+  for (size_t pos = 90; pos < 40100; ++pos) {
+    bits[pos] = bit::bit1;
+    roaring.set(pos);
+  }
+  expect_matches(roaring, bits);
+  // Still runs, not an 8 KiB bitmap
+  EXPECT_LT(roaring.memory_usage(), 8192);
+}
+
+TEST(RoaringBitmap, Find) {
+  bit::bit_vector<uint64_t> bits(2 * chunk + 10);
+  bit::roaring_bitmap roaring(bits.size());
+  roaring.set(chunk + 3);
+  EXPECT_EQ(roaring.find(), chunk + 3);
+  EXPECT_EQ(roaring.find(bit::bit0), 0);
+  bit::bit_vector<uint64_t> ones(100, bit::bit1);
+  bit::roaring_bitmap full(ones);
+  EXPECT_EQ(full.find(bit::bit0), 100);
+  full.reset(42);
+  EXPECT_EQ(full.find(bit::bit0), 42);
+
+  // Full run chunk, then an array chunk with a gap at 7
+  bit::bit_vector<uint64_t> dense(2 * chunk + 100, bit::bit1);
+  for (size_t pos = chunk + 4096; pos < dense.size(); ++pos) {
+    dense[pos] = bit::bit0;
+  }
+  dense[chunk + 7] = bit::bit0;
+  bit::roaring_bitmap clustered(dense);
+  EXPECT_EQ(clustered.find(bit::bit0), chunk + 7);
+  clustered.set(chunk + 7);
+  EXPECT_EQ(clustered.find(bit::bit0), chunk + 4096);
+  bit::bit_vector<uint64_t> all(chunk + 5, bit::bit1);
+  EXPECT_EQ(bit::roaring_bitmap(all).find(bit::bit0), all.size());
+}
+
+TEST(RoaringBitmap, BitView) {
+  const auto bits = mixed_bits(4);
+  bit::roaring_bitmap roaring(bits);
+  const auto view = roaring.bits();
+  static_assert(std::random_access_iterator<decltype(view.begin())>);
+  static_assert(bit::bit_sized_range<decltype(view)>);
+  ASSERT_EQ(view.size(), bits.size());
+  EXPECT_TRUE(std::equal(view.begin(), view.end(), bits.begin(), bits.end()));
+  EXPECT_EQ(std::count(view.begin() + chunk, view.begin() + 2 * chunk, bit::bit1),
+            bit::count(bits.begin() + chunk, bits.begin() + 2 * chunk, bit::bit1));
+  EXPECT_EQ(view.end()[-1], bits[bits.size() - 1]);
+  bit::bit_vector<uint64_t> copied(view.size());
+  std::copy(view.begin() + 5, view.end(), copied.begin() + 5);
+  std::copy(view.begin(), view.begin() + 5, copied.begin());
+  EXPECT_EQ(copied, bits);
+}
+
+TEST(RoaringBitmap, SetOperations) {
+  const auto bits_a = mixed_bits(2);
+  const auto bits_b = mixed_bits(3);
+  bit::roaring_bitmap a(bits_a);
+  bit::roaring_bitmap b(bits_b);
+
+  bit::bit_vector<uint64_t> expected(bits_a.size());
+  expected.assign_range(bits_a | bits_b);
+  expect_matches(a | b, expected);
+  expected.assign_range(bits_a & bits_b);
+  expect_matches(a & b, expected);
+  expected.assign_range(bits_a ^ bits_b);
+  expect_matches(a ^ b, expected);
+  expected.assign_range(bits_a & ~bits_b);
+  expect_matches(a - b, expected);
+
+  bit::roaring_bitmap c = a;
+  c -= a;
+  EXPECT_TRUE(c.empty());
+  c |= b;
+  EXPECT_EQ(c, b);
+  c &= a;
+  EXPECT_EQ(c, a & b);
+  c ^= c;
+  EXPECT_TRUE(c.empty());
+}
+
+TEST(RoaringBitmap, SparseIsSmall) {
+  bit::roaring_bitmap roaring(size_t{1} << 30);
+  std::mt19937 gen(11);
+  for (size_t i = 0; i < 10000; ++i) {
+    roaring.set(gen() % roaring.size());
+  }
+  EXPECT_LT(roaring.memory_usage() * 50, roaring.size() / 8);
+}
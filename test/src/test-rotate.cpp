@@ -11,6 +11,9 @@
 // C++ standard library
 #include <math.h>
 #include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
 // Project sources
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
 #include "bitlib/bit-containers/bit-containers.hpp"
@@ -44,3 +47,64 @@ TYPED_TEST(SingleRangeTest, Rotate) {
 }
 
 
+
+// Counts the words taken from it so the scratch path can be observed
+template <class T>
+struct counting_allocator : std::allocator<T> {
+    using value_type = T;
+    template <class U>
+    struct rebind {
+        using other = counting_allocator<U>;
+    };
+    size_t* words;
+    explicit counting_allocator(size_t* w) : words(w) {}
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) : words(other.words) {}
+    T* allocate(size_t n) {
+        *words += n;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+TEST(Rotate, LargeWithAllocator) {
+    const size_t n = 100000;
+    bit::bit_vector<uint32_t> bitvec(n);
+    std::vector<bool> boolvec(n);
+    std::mt19937 gen(7);
+    for (size_t i = 0; i < n; ++i) {
+        boolvec[i] = gen() & 1;
+        bitvec[i] = boolvec[i] ? bit::bit1 : bit::bit0;
+    }
+    for (size_t start : {0, 5}) {
+        for (size_t middle : {size_t{100}, size_t{33333}, size_t{50000}, size_t{77777}, n - 70}) {
+            size_t words = 0;
+            auto bitret = bit::rotate(bitvec.begin() + start, bitvec.begin() + middle, bitvec.end(),
+                                      counting_allocator<char>(&words));
+            auto boolret = std::rotate(boolvec.begin() + start, boolvec.begin() + middle, boolvec.end());
+            EXPECT_GT(words, 0u);
+            EXPECT_LE(words * 32, std::min(middle - start, n - middle) + 64);
+            EXPECT_TRUE(std::equal(bitvec.begin(), bitvec.end(), boolvec.begin(), boolvec.end(), comparator));
+            EXPECT_EQ(std::distance(bitvec.begin(), bitret), std::distance(boolvec.begin(), boolret));
+        }
+    }
+}
+
+// The in-place block swap is only reached past the scratch limit, so it is
+// checked directly
+TYPED_TEST(SingleRangeTest, RotateInPlace) {
+    using WordType = typename TestFixture::base_type;
+    for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+        bit::bit_vector<WordType>& bitvec = this->random_bitvecs[idx];
+        std::vector<bool> boolvec = this->random_boolvecs[idx];
+        if (bitvec.size() < 4 * bit::binary_digits<WordType>::value) {
+            continue;
+        }
+        const unsigned long long start = generate_random_number(0, 16);
+        const unsigned long long middle = generate_random_number(start + 1, bitvec.size() - 1);
+        auto bitret = bit::_rotate_via_raw(bitvec.begin() + start, bitvec.begin() + middle, bitvec.end(),
+                                           std::random_access_iterator_tag());
+        auto boolret = std::rotate(boolvec.begin() + start, boolvec.begin() + middle, boolvec.end());
+        EXPECT_TRUE(std::equal(bitvec.begin(), bitvec.end(), boolvec.begin(), boolvec.end(), comparator));
+        EXPECT_EQ(std::distance(bitvec.begin(), bitret), std::distance(boolvec.begin(), boolret));
+    }
+}
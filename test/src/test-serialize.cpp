@@ -0,0 +1,171 @@
+// ============================ SERIALIZE TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for binary serialization of bit ranges
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+namespace {
+
+constexpr std::endian other_endian =
+    (std::endian::native == std::endian::little) ? std::endian::big : std::endian::little;
+
+}  // namespace
+
+template <typename WordType>
+class SerializeTest : public testing::Test {};
+TYPED_TEST_SUITE(SerializeTest, BaseTypes);
+
+TYPED_TEST(SerializeTest, RoundTrip) {
+  auto random = get_random_bvec<TypeParam>(2000);
+  for (size_t size : {0, 1, 7, 64, 65, 1000, 2000}) {
+    for (std::endian endian : {std::endian::native, other_endian}) {
+      bit::bit_vector<TypeParam> bits(random.begin(), random.begin() + size);
+      std::stringstream stream;
+      bit::serial::write(bits, bit::serial::stream_sink(stream), endian, 16);
+      EXPECT_EQ(stream.str().size(),
+                bit::serial::header_bytes + (size + bit::bitsof<TypeParam>() - 1) / bit::bitsof<TypeParam>() * sizeof(TypeParam) +
+                    bit::serial::trailer_bytes);
+
+      bit::serial::stream_source source(stream);
+      auto back = bit::serial::read<TypeParam>(source, 24);
+      EXPECT_EQ(back, bits) << "size " << size;
+    }
+  }
+}
+
+TYPED_TEST(SerializeTest, UnalignedAndMixedWords) {
+  auto random = get_random_bvec<TypeParam>(3000);
+  auto first = random.begin() + 13;
+  auto last = random.begin() + 2900;
+
+  std::stringstream stream;
+  bit::serial::write(first, last, bit::serial::stream_sink(stream), other_endian);
+  std::stringstream copy(stream.str());
+
+  bit::serial::stream_source source(stream);
+  auto narrow = bit::serial::read<uint8_t>(source);
+  ASSERT_EQ(narrow.size(), 2887);
+  EXPECT_TRUE(std::equal(first, last, narrow.begin()));
+
+  bit::bit_vector<uint64_t> wide(2887);
+  bit::serial::read(bit::serial::stream_source(copy), wide);
+  EXPECT_TRUE(std::equal(first, last, wide.begin()));
+}
+
+TEST(Serialize, ByteLayout) {
+  bit::bit_vector<uint16_t> bits(20);
+  bits[0] = bit::bit1;
+  bits[9] = bit::bit1;
+  bits[17] = bit::bit1;
+  std::stringstream stream;
+  bit::serial::write(bits, bit::serial::stream_sink(stream), std::endian::big);
+  const std::string bytes = stream.str();
+  ASSERT_EQ(bytes.size(), 16 + 4 + 8);
+  EXPECT_EQ(bytes.substr(0, 4), "BITL");
+  EXPECT_EQ(bytes[4], 1);
+  EXPECT_EQ(bytes[5], 0);
+  EXPECT_EQ(bytes[6], 2);
+  EXPECT_EQ(bytes[7], 1);
+  EXPECT_EQ(bytes[8], 20);
+  // big endian words 0x0201 and 0x0002
+  EXPECT_EQ(bytes[16], 0x02);
+  EXPECT_EQ(bytes[17], 0x01);
+  EXPECT_EQ(bytes[18], 0x00);
+  EXPECT_EQ(bytes[19], 0x02);
+}
+
+TEST(Serialize, Errors) {
+  auto bits = get_random_bvec<uint32_t>(500);
+  std::stringstream stream;
+  bit::serial::write(bits, bit::serial::stream_sink(stream));
+  const std::string good = stream.str();
+
+  std::string corrupt = good;
+  corrupt[40] ^= 0x10;
+  std::stringstream corrupt_stream(corrupt);
+  EXPECT_THROW(bit::serial::read(bit::serial::stream_source(corrupt_stream)), std::runtime_error);
+
+  std::stringstream truncated(good.substr(0, good.size() - 3));
+  EXPECT_THROW(bit::serial::read(bit::serial::stream_source(truncated)), std::runtime_error);
+
+  std::stringstream not_bits("hello, world, not a bitmap");
+  EXPECT_THROW(bit::serial::read(bit::serial::stream_source(not_bits)), std::runtime_error);
+
+  std::stringstream wrong_size(good);
+  bit::bit_vector<uint32_t> small(499);
+  EXPECT_THROW(bit::serial::read(bit::serial::stream_source(wrong_size), small), std::invalid_argument);
+}
+
+TEST(Serialize, UntrustedLength) {
+  bit::bit_vector<uint16_t> bits(100, bit::bit1);
+  std::stringstream stream;
+  bit::serial::write(bits, bit::serial::stream_sink(stream));
+  const std::string good = stream.str();
+
+  // One bit past what the payload holds
+  std::string longer = good;
+  longer[8] = static_cast<char>(113);
+  std::stringstream longer_stream(longer);
+  EXPECT_THROW(bit::serial::read(bit::serial::stream_source(longer_stream)), std::runtime_error);
+
+  std::string huge = good;
+  std::fill(huge.begin() + 8, huge.begin() + 16, static_cast<char>(0xFF));
+  std::stringstream huge_stream(huge);
+  EXPECT_THROW(bit::serial::read(bit::serial::stream_source(huge_stream)), std::runtime_error);
+
+  // A source that cannot tell its length still never computes an
+  // overflowed size or allocates for it
+  std::size_t offset = 0;
+  auto unsized = [&](std::byte* data, std::size_t n) {
+    if (n > huge.size() - offset) {
+      throw std::runtime_error("end of buffer");
+    }
+    std::copy_n(reinterpret_cast<const std::byte*>(huge.data()) + offset, n, data);
+    offset += n;
+  };
+  EXPECT_THROW(bit::serial::read<uint8_t>(unsized), std::length_error);
+
+  std::stringstream exact(good);
+  bit::serial::stream_source source(exact);
+  EXPECT_EQ(source.remaining(), good.size());
+  EXPECT_EQ(bit::serial::read<uint16_t>(source), bits);
+  EXPECT_EQ(source.remaining(), 0);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(Serialize, FileDescriptor) {
+  const auto path = std::filesystem::temp_directory_path() / "bitlib-serialize.bits";
+  auto bits = get_random_bvec<uint64_t>(100000);
+  FILE* file = std::fopen(path.c_str(), "wb");
+  ASSERT_NE(file, nullptr);
+  bit::serial::write(bits, bit::serial::fd_sink(fileno(file)), std::endian::native, 4096);
+  std::fclose(file);
+
+  file = std::fopen(path.c_str(), "rb");
+  ASSERT_NE(file, nullptr);
+  auto back = bit::serial::read<uint64_t>(bit::serial::fd_source(fileno(file)), 4096);
+  std::fclose(file);
+  std::filesystem::remove(path);
+  EXPECT_EQ(back, bits);
+}
+#endif
@@ -0,0 +1,77 @@
+// ============================ SET BITS TESTS ============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for set_bits and for_each_set_bit
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+static_assert(std::ranges::bidirectional_range<bit::bit_set_bits_view<uint64_t*>>);
+static_assert(std::ranges::view<bit::bit_set_bits_view<uint64_t*>>);
+
+TYPED_TEST(SingleRangeTest, SetBits) {
+  using WordType = typename TestFixture::base_type;
+  constexpr auto digits = bit::binary_digits<WordType>::value;
+  for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+    bit::bit_vector<WordType>& bitvec = this->random_bitvecs[idx];
+    std::vector<bool>& boolvec = this->random_boolvecs[idx];
+    const long long start = generate_random_number(0, std::min<long long>(bitvec.size() - 1, digits + 1));
+    const long long end = generate_random_number(start, bitvec.size());
+    const auto first = bitvec.begin() + start;
+    const auto last = bitvec.begin() + end;
+
+    std::vector<size_t> expected;
+    for (long long i = start; i < end; ++i) {
+      if (boolvec[i]) {
+        expected.push_back(i - start);
+      }
+    }
+    std::vector<size_t> reversed(expected.rbegin(), expected.rend());
+
+    const auto view = bit::set_bits(first, last);
+    EXPECT_EQ(std::vector<size_t>(view.begin(), view.end()), expected);
+    const auto backward = view | std::views::reverse;
+    EXPECT_EQ(std::vector<size_t>(backward.begin(), backward.end()), reversed);
+
+    std::vector<size_t> visited;
+    bit::for_each_set_bit(first, last, [&visited](size_t i) { visited.push_back(i); });
+    EXPECT_EQ(visited, expected);
+    visited.clear();
+    bit::for_each_set_bit_backward(first, last, [&visited](size_t i) { visited.push_back(i); });
+    EXPECT_EQ(visited, reversed);
+  }
+}
+
+TEST(SetBits, Sparse) {
+  bit::bit_vector<uint8_t> bv(100);
+  EXPECT_TRUE(bit::set_bits(bv).empty());
+  for (size_t i : {0, 7, 8, 63, 64, 99}) {
+    bv[i] = bit::bit1;
+  }
+  auto view = bit::set_bits(bv);
+  EXPECT_EQ(std::ranges::distance(view), 6);
+  EXPECT_EQ(view.front(), 0);
+  EXPECT_EQ(view.back(), 99);
+
+  // Indices are relative to the start of the range
+  auto sub = bit::set_bits(bv.begin() + 8, bv.begin() + 64);
+  EXPECT_EQ(std::vector<size_t>(sub.begin(), sub.end()), (std::vector<size_t>{0, 55}));
+  auto it = sub.end();
+  EXPECT_EQ(*--it, 55);
+  EXPECT_EQ(*--it, 0);
+  EXPECT_EQ(it, sub.begin());
+}
@@ -10,6 +10,8 @@
 // C++ standard library
 #include <math.h>
 #include <algorithm>
+#include <ranges>
+#include <vector>
 // Project sources
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
 #include "bitlib/bit-containers/bit-containers.hpp"
@@ -64,3 +66,68 @@ TYPED_TEST(SingleRangeTest, ShiftRight) {
 
 //REGISTER_TYPED_TEST_SUITE_P(, DoesBlah, HasPropertyA);
 //INSTANTIATE_TYPED_TEST_SUITE_P(Instantiation, SingleRangeTest, BaseTypes);
+
+// std::vector<bool> reference for the integral-style operators
+static std::vector<bool> shifted_up(std::vector<bool> v, size_t n) {
+    std::fill(v.begin(), std::shift_right(v.begin(), v.end(), n), false);
+    return v;
+}
+static std::vector<bool> shifted_down(std::vector<bool> v, size_t n) {
+    std::fill(std::shift_left(v.begin(), v.end(), n), v.end(), false);
+    return v;
+}
+
+TYPED_TEST(SingleRangeTest, ShiftOperators) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+        const bit::bit_vector<WordType>& bitvec = this->random_bitvecs[idx];
+        const std::vector<bool>& boolvec = this->random_boolvecs[idx];
+        const size_t n = generate_random_number(0, bitvec.size() + digits);
+
+        bit::bit_vector<WordType> up = bitvec << n;
+        EXPECT_TRUE(std::ranges::equal(up, shifted_up(boolvec, n), comparator));
+        bit::bit_vector<WordType> down = bitvec;
+        down >>= n;
+        EXPECT_TRUE(std::ranges::equal(down, shifted_down(boolvec, n), comparator));
+
+        bit::bit_array<std::dynamic_extent, WordType> dynamic(bitvec);
+        dynamic <<= n;
+        EXPECT_TRUE(std::ranges::equal(dynamic, up, comparator));
+
+        // A view shifts only the referenced bits
+        if (bitvec.size() > 10) {
+            bit::bit_array<std::dynamic_extent, WordType> outer(bitvec);
+            auto view = outer(3, outer.size() - 4);
+            view >>= n;
+            const size_t k = view.size();
+            std::vector<bool> expected = boolvec;
+            const std::vector<bool> middle = shifted_down(std::vector<bool>(boolvec.begin() + 3, boolvec.begin() + 3 + k), n);
+            std::copy(middle.begin(), middle.end(), expected.begin() + 3);
+            EXPECT_TRUE(std::ranges::equal(outer, expected, comparator));
+        }
+    }
+}
+
+TEST(ShiftOperators, FixedExtent) {
+    bit::bit_array<100, uint32_t> a;
+    std::vector<bool> ref(100);
+    for (size_t i = 0; i < 100; ++i) {
+        ref[i] = (i * 7 + i / 5) % 3 == 0;
+        a[i] = ref[i] ? bit::bit1 : bit::bit0;
+    }
+    for (size_t n : {0, 1, 31, 32, 33, 64, 99, 100, 150}) {
+        EXPECT_TRUE(std::ranges::equal(a << n, shifted_up(ref, n), comparator)) << n;
+        EXPECT_TRUE(std::ranges::equal(a >> n, shifted_down(ref, n), comparator)) << n;
+    }
+    auto b = a;
+    bit::shift_right<37>(b);
+    EXPECT_EQ(b, a << 37);
+    bit::shift_left<37>(b);
+    EXPECT_EQ(b, (a << 37) >> 37);
+
+    // Behaves like the integral it was made from
+    const uint64_t value = 0x0123456789ABCDEF;
+    EXPECT_EQ(static_cast<uint64_t>(bit::bit_array<64>(value) << 12), value << 12);
+    EXPECT_EQ(static_cast<uint64_t>(bit::bit_array<64>(value) >> 12), value >> 12);
+}
@@ -0,0 +1,184 @@
+// =========================== SMALL VECTOR TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for bit_vector with inline storage
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+namespace {
+
+size_t allocations = 0;
+
+template <typename T>
+struct counting_allocator : std::allocator<T> {
+  using value_type = T;
+  counting_allocator() = default;
+  template <typename U>
+  counting_allocator(const counting_allocator<U>&) {}
+  T* allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>::allocate(n);
+  }
+  template <typename U>
+  struct rebind {
+    using other = counting_allocator<U>;
+  };
+};
+
+// Stateful allocator: equal only to allocators with the same id
+template <typename T, bool Propagate>
+struct tagged_allocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+  using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+  using is_always_equal = std::false_type;
+  int id = 0;
+  tagged_allocator() = default;
+  explicit tagged_allocator(int tag) : id(tag) {}
+  template <typename U>
+  tagged_allocator(const tagged_allocator<U, Propagate>& other) : id(other.id) {}
+  T* allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) {
+    std::allocator<T>().deallocate(p, n);
+  }
+  template <typename U>
+  struct rebind {
+    using other = tagged_allocator<U, Propagate>;
+  };
+  friend bool operator==(const tagged_allocator& lhs, const tagged_allocator& rhs) {
+    return lhs.id == rhs.id;
+  }
+};
+
+template <typename WordType>
+using small_vector = bit::bit_vector<WordType, counting_allocator<WordType>, 256>;
+
+template <typename WordType>
+void expect_equal(const small_vector<WordType>& bv, const std::vector<bool>& expected) {
+  ASSERT_EQ(bv.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(static_cast<bool>(bv[i]), expected[i]) << "at " << i;
+  }
+}
+
+}  // namespace
+
+template <typename WordType>
+class SmallVectorTest : public testing::Test {};
+
+using SmallVectorWordTypes = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(SmallVectorTest, SmallVectorWordTypes);
+
+TYPED_TEST(SmallVectorTest, InlineNeverAllocates) {
+  allocations = 0;
+  small_vector<TypeParam> bv;
+  std::vector<bool> expected;
+  for (size_t i = 0; i < 200; ++i) {
+    bv.push_back((i % 3) ? bit::bit1 : bit::bit0);
+    expected.push_back(i % 3);
+  }
+  bv.insert(bv.begin() + 5, bit::bit1);
+  expected.insert(expected.begin() + 5, true);
+  bv.erase(bv.begin() + 100, bv.begin() + 120);
+  expected.erase(expected.begin() + 100, expected.begin() + 120);
+  bv.append_range(small_vector<TypeParam>(10, bit::bit1));
+  expected.insert(expected.end(), 10, true);
+  auto copy = bv;
+  auto moved = std::move(copy);
+  EXPECT_EQ(allocations, 0);
+  expect_equal(moved, expected);
+  EXPECT_GE(moved.capacity(), 256);
+}
+
+TYPED_TEST(SmallVectorTest, SpillsToHeap) {
+  std::mt19937 gen(7);
+  small_vector<TypeParam> bv;
+  std::vector<bool> expected;
+  for (size_t i = 0; i < 1000; ++i) {
+    const bool b = gen() & 1;
+    const size_t pos = gen() % (expected.size() + 1);
+    bv.insert(bv.begin() + pos, b ? bit::bit1 : bit::bit0);
+    expected.insert(expected.begin() + pos, b);
+  }
+  expect_equal(bv, expected);
+
+  allocations = 0;
+  small_vector<TypeParam> moved = std::move(bv);
+  EXPECT_EQ(allocations, 0);
+  expect_equal(moved, expected);
+  EXPECT_TRUE(bv.empty());
+
+  small_vector<TypeParam> copy;
+  copy = moved;
+  expect_equal(copy, expected);
+
+  // Shrinking back under the inline capacity returns to inline storage
+  while (moved.size() > 100) {
+    moved.pop_back();
+    expected.pop_back();
+  }
+  moved.shrink_to_fit();
+  expect_equal(moved, expected);
+  allocations = 0;
+  auto again = moved;
+  EXPECT_EQ(allocations, 0);
+  expect_equal(again, expected);
+
+  moved.resize(700, bit::bit1);
+  expected.resize(700, true);
+  expect_equal(moved, expected);
+}
+
+TEST(SmallWordVector, AllocatorPropagation) {
+  using propagating = bit::detail::small_word_vector<uint64_t, 2, tagged_allocator<uint64_t, true>>;
+  using sticky = bit::detail::small_word_vector<uint64_t, 2, tagged_allocator<uint64_t, false>>;
+  static_assert(std::is_nothrow_move_assignable_v<propagating>);
+  static_assert(!std::is_nothrow_move_assignable_v<sticky>);
+  static_assert(std::is_nothrow_move_assignable_v<bit::detail::small_word_vector<uint64_t, 2>>);
+  static_assert(std::is_nothrow_move_assignable_v<bit::bit_vector<uint64_t, std::allocator<uint64_t>, 128>>);
+  static_assert(!std::is_nothrow_move_assignable_v<bit::bit_vector<uint64_t, tagged_allocator<uint64_t, false>, 128>>);
+
+  propagating heap(10, 7, tagged_allocator<uint64_t, true>(1));
+  propagating a(tagged_allocator<uint64_t, true>(2));
+  a = heap;
+  EXPECT_EQ(a.get_allocator().id, 1);
+  EXPECT_EQ(a, heap);
+  propagating b(5, 3, tagged_allocator<uint64_t, true>(3));
+  b = std::move(a);
+  EXPECT_EQ(b.get_allocator().id, 1);
+  EXPECT_EQ(b, heap);
+  EXPECT_TRUE(a.empty());
+  propagating inline_words(1, 9, tagged_allocator<uint64_t, true>(4));
+  b = std::move(inline_words);
+  EXPECT_EQ(b.get_allocator().id, 4);
+  EXPECT_EQ(b.size(), 1);
+  EXPECT_EQ(b[0], 9);
+
+  sticky source(10, 7, tagged_allocator<uint64_t, false>(1));
+  sticky c(tagged_allocator<uint64_t, false>(2));
+  c = source;
+  EXPECT_EQ(c.get_allocator().id, 2);
+  allocations = 0;
+  c = std::move(source);
+  EXPECT_EQ(c.get_allocator().id, 2);
+  EXPECT_EQ(c.size(), 10);
+  EXPECT_EQ(allocations, 0);
+}
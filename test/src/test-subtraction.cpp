@@ -0,0 +1,60 @@
+#include <limits>
+
+#include "bitlib/bitlib.hpp"
+#include "gtest/gtest.h"
+#include "test_utils.hpp"
+
+TEST(BitSubtraction, Basic) {
+  auto bits = 0xF'10_b;
+  EXPECT_EQ(0, bit::subtraction(bits.begin(), bits.end(), static_cast<uint8_t>(0x1u)));
+  EXPECT_EQ(0xF'0F_b, bits);
+}
+
+TEST(BitSubtraction, Borrow) {
+  auto bits = 0x7'0_b;
+  EXPECT_EQ(1, bit::subtraction(bits.begin(), bits.end(), 1'1_b));
+  EXPECT_EQ(0x7'7F_b, bits);
+}
+
+TEST(BitSubtraction, Range) {
+  auto lhs = 0x10'0100_b;
+  auto rhs = 0x10'0001_b;
+  auto diff = 0x10'0_b;
+  EXPECT_EQ(0, bit::subtraction(lhs.begin(), lhs.end(), rhs.begin(), diff.begin()));
+  EXPECT_EQ(0x10'00FF_b, diff);
+  auto zero = 0x10'0000_b;
+  EXPECT_EQ(1, bit::subtraction(zero.begin(), zero.end(), rhs.begin(), zero.begin()));
+  EXPECT_EQ(0x10'FFFF_b, zero);
+}
+
+template <typename WordType>
+void check_range_subtraction() {
+  // Compare against a bit-serial ripple borrow over every width and alignment
+  auto lhs = get_random_bvec<WordType>(256);
+  auto rhs = get_random_bvec<WordType>(256);
+  for (size_t width = 1; width <= 200; ++width) {
+    for (size_t offset1 : {0, 3}) {
+      for (size_t offset2 : {0, 5}) {
+        bit::bit_vector<WordType> diff(width + 7);
+        const auto first1 = lhs.begin() + offset1;
+        const auto first2 = rhs.begin() + offset2;
+        const auto borrow = bit::subtraction(first1, first1 + width, first2, diff.begin() + 1);
+        bool c = false;
+        for (size_t i = 0; i < width; ++i) {
+          const bool a = static_cast<bool>(first1[i]);
+          const bool b = static_cast<bool>(first2[i]);
+          const bool d = a ^ b ^ c;
+          ASSERT_EQ(static_cast<bool>(diff[i + 1]), d) << width << " at " << i;
+          c = (!a && b) || (c && (a == b));
+        }
+        EXPECT_EQ(borrow, static_cast<unsigned char>(c)) << width;
+        EXPECT_EQ(diff[0], bit::bit0);
+      }
+    }
+  }
+}
+
+TEST(BitSubtraction, RangeRandom) {
+  check_range_subtraction<uint16_t>();
+  check_range_subtraction<uint64_t>();
+}
@@ -1,12 +1,15 @@
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "bitlib/bit-algorithms/count.hpp"
 #include "bitlib/bit-algorithms/to_from_string.hpp"
 #include "bitlib/bit-containers/bit_array.hpp"
 #include "bitlib/bit-containers/bit_array_dynamic_extent.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
 #include "fixtures.hpp"
 
 // Third-party libraries
@@ -34,6 +37,64 @@ TEST(ToString, base10) {
   EXPECT_EQ(str, "123");
 }
 
+TEST(ToString, base10MultiWord) {
+  bit::bit_array<> zero(200, bit::bit0);
+  EXPECT_EQ(bit::to_string<bit::string::typical(10)>(zero), "0");
+  bit::bit_array<> ones(200, bit::bit1);
+  EXPECT_EQ(bit::to_string<bit::string::typical(10)>(ones),
+            "1606938044258990275541962092341162602522202993782792835301375");
+  bit::bit_array<> pow2_64(65, bit::bit0);
+  pow2_64[64] = bit::bit1;
+  EXPECT_EQ(bit::to_string<bit::string::typical(10)>(pow2_64), "18446744073709551616");
+}
+
+TEST(ToString, base10Reciprocal) {
+  // mu * d <= B^(2m) < (mu + 1) * d
+  std::mt19937_64 gen(3);
+  for (size_t m = 1; m < 150; m += (m < 12) ? 1 : 13) {
+    for (int variant = 0; variant < 3; ++variant) {
+      std::vector<uint64_t> d(m);
+      for (auto& limb : d) {
+        limb = (variant == 0) ? gen() : (variant == 1) ? ~uint64_t{0} : 0;
+      }
+      d.back() |= (variant == 2) ? 1 : 0;
+      if (d.back() == 0) {
+        d.back() = 1;
+      }
+      const auto mu = bit::detail::limbs_reciprocal(d);
+      std::vector<uint64_t> bound(2 * m + 1, 0);
+      bound[2 * m] = 1;
+      auto below = bit::detail::limbs_product(mu, d);
+      EXPECT_LE(bit::detail::limbs_compare(below.data(), below.size(), bound.data(), bound.size()), 0) << m;
+      std::vector<uint64_t> mu1 = mu;
+      mu1.push_back(0);
+      const uint64_t one = 1;
+      bit::detail::limbs_add_in_place(mu1.data(), mu1.size(), &one, 1);
+      auto above = bit::detail::limbs_product(mu1, d);
+      EXPECT_GT(bit::detail::limbs_compare(above.data(), above.size(), bound.data(), bound.size()), 0) << m;
+    }
+  }
+}
+
+TEST(ToString, base10Split) {
+  // Splitting by powers of ten gives the same chunks as peeling them one by one
+  for (size_t size : {4000, 4096, 4097, 9000, 40000, 100000}) {
+    const auto bits = get_random_bvec<uint64_t>(size);
+    const auto limbs = bit::detail::gather_limbs(bits.begin(), size);
+    const auto chunks = bit::detail::limbs_to_decimal(limbs);
+    std::vector<uint64_t> expected(size / 63 + 2);
+    bit::detail::limbs_to_decimal_schoolbook(limbs, expected.data(), expected.size());
+    while (expected.size() > 1 && expected.back() == 0) {
+      expected.pop_back();
+    }
+    EXPECT_EQ(chunks, expected) << "size " << size;
+
+    bit::bit_vector<uint64_t> parsed(size);
+    bit::from_string<bit::string::typical(10)>(bit::to_string<bit::string::typical(10)>(bits), parsed);
+    EXPECT_EQ(parsed, bits) << "size " << size;
+  }
+}
+
 TEST(ToString, Streaming) {
   std::stringstream sstr;
   auto num = 10'123_b;
@@ -52,6 +113,31 @@ TEST(FromString, Blah) {
   EXPECT_EQ(arr_16, 16'123_b);
 }
 
+TEST(FromString, base10MultiWord) {
+  bit::bit_array<> bits(136);
+  bit::from_string<bit::string::typical(10)>("10000000000000000000000000000000000000000", bits);
+  EXPECT_EQ(bit::to_string<bit::string::typical(16)>(bits), "1D6329F1C35CA4BFABB9F5610000000000");
+  // Overflowing values are truncated
+  bit::bit_array<> low(16);
+  bit::from_string<bit::string::typical(10)>("18446744073709551617", low);
+  EXPECT_EQ(low, 0x10'0001_b);
+}
+
+TEST(FromString, base10RoundTrip) {
+  for (size_t size : {1, 63, 64, 65, 1000, 20000}) {
+    bit::bit_array<> bits(size);
+    bit::from_string<bit::string::typical(16)>(
+        std::string((size + 3) / 4, 'F'), bits);
+    for (size_t i = 0; i < size; i += 7) {
+      bits[i] = bit::bit0;
+    }
+    const auto str = bit::to_string<bit::string::typical(10)>(bits);
+    bit::bit_array<> parsed(size);
+    bit::from_string<bit::string::typical(10)>(str, parsed);
+    EXPECT_EQ(parsed, bits) << "size " << size;
+  }
+}
+
 TEST(FromString, IntoBookendRange) {
   for (const auto word : get_random_vec<uint32_t>(64)) {
     for (int i = 1; i < 8; i++) {
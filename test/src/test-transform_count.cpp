@@ -0,0 +1,52 @@
+// ========================== TRANSFORM COUNT TESTS ========================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for transform_count and count_and/or/xor/andnot
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+TYPED_TEST(DoubleRangeTest, TransformCount) {
+  using WordType = typename TestFixture::base_type;
+  constexpr auto digits = bit::binary_digits<WordType>::value;
+  for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+    bit::bit_vector<WordType>& bitvec1 = this->random_bitvecs1[idx];
+    bit::bit_vector<WordType>& bitvec2 = this->random_bitvecs2[idx];
+    std::vector<bool>& boolvec1 = this->random_boolvecs1[idx];
+    std::vector<bool>& boolvec2 = this->random_boolvecs2[idx];
+    const long long start1 = generate_random_number(0, std::min<long long>(bitvec1.size() - 1, digits + 1));
+    const long long start2 = generate_random_number(0, std::min<long long>(bitvec2.size() - 1, digits + 1));
+    const long long length = std::min<long long>(bitvec1.size() - start1, bitvec2.size() - start2);
+
+    long long expected_and = 0, expected_or = 0, expected_xor = 0, expected_andnot = 0;
+    for (long long i = 0; i < length; ++i) {
+      const bool a = boolvec1[start1 + i];
+      const bool b = boolvec2[start2 + i];
+      expected_and += a && b;
+      expected_or += a || b;
+      expected_xor += a != b;
+      expected_andnot += a && !b;
+    }
+
+    const auto first1 = bitvec1.begin() + start1;
+    const auto last1 = first1 + length;
+    const auto first2 = bitvec2.begin() + start2;
+    EXPECT_EQ(bit::count_and(first1, last1, first2), expected_and);
+    EXPECT_EQ(bit::count_or(first1, last1, first2), expected_or);
+    EXPECT_EQ(bit::count_xor(first1, last1, first2), expected_xor);
+    EXPECT_EQ(bit::count_andnot(first1, last1, first2), expected_andnot);
+    EXPECT_EQ(bit::transform_count(first1, last1, first2, std::bit_xor<>{}), expected_xor);
+  }
+}
@@ -0,0 +1,82 @@
+// ============================== WORDS TESTS =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the bit_word_view segmented iteration
+// Contributor(s):  Peter McLean
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+static_assert(std::ranges::random_access_range<bit::bit_word_view<uint64_t*>>);
+static_assert(std::ranges::view<bit::bit_word_view<uint64_t*>>);
+static_assert(std::ranges::sized_range<bit::bit_word_view<uint64_t*>>);
+
+TYPED_TEST(SingleRangeTest, Words) {
+  using WordType = typename TestFixture::base_type;
+  constexpr auto digits = bit::binary_digits<WordType>::value;
+  for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+    bit::bit_vector<WordType>& bitvec = this->random_bitvecs[idx];
+    std::vector<bool>& boolvec = this->random_boolvecs[idx];
+    const long long start = generate_random_number(0, std::min<long long>(bitvec.size() - 1, digits + 1));
+    const long long end = generate_random_number(start, bitvec.size());
+    const auto first = bitvec.begin() + start;
+    const auto last = bitvec.begin() + end;
+
+    // Segments tile the range in order and agree with the bits
+    size_t offset = 0;
+    const auto segments = bit::words(first, last);
+    for (auto it = segments.begin(); it != segments.end(); ++it) {
+      const auto segment = *it;
+      ASSERT_NE(segment.mask, WordType{0});
+      ASSERT_EQ(it.offset(), offset);
+      ASSERT_EQ(it.base(), (first + offset).base());
+      ASSERT_EQ(segment.position(), (first + offset).position());
+      for (size_t i = 0; i < segment.size(); ++i) {
+        ASSERT_EQ(static_cast<bool>((segment.value() >> i) & 1), boolvec[start + offset + i]);
+      }
+      offset += segment.size();
+    }
+    EXPECT_EQ(offset, static_cast<size_t>(end - start));
+
+    size_t expected = std::count(boolvec.begin() + start, boolvec.begin() + end, true);
+    size_t ones = 0;
+    for (const auto segment : segments) {
+      ones += std::popcount(static_cast<std::make_unsigned_t<WordType>>(segment.word & segment.mask));
+    }
+    EXPECT_EQ(ones, expected);
+    // Only the first and last segment can be partial
+    EXPECT_LE(std::ranges::count_if(segments, [](const auto& s) { return !s.full(); }), 2);
+  }
+}
+
+TEST(Words, Ranges) {
+  bit::bit_vector<uint8_t> bv(20, bit::bit1);
+  auto all = bit::words(bv);
+  ASSERT_EQ(all.size(), 3);
+  EXPECT_TRUE(all[0].full());
+  EXPECT_TRUE(all[1].full());
+  EXPECT_EQ(all[2].mask, 0x0F);
+
+  uint8_t storage[3] = {0xFF, 0xFF, 0xFF};
+  auto span = bit::words(bit::bit_span<uint8_t>(storage, 20).subspan(3, 6));
+  ASSERT_EQ(span.size(), 2);
+  EXPECT_EQ(span.front().mask, 0xF8);
+  EXPECT_EQ(span.back().mask, 0x01);
+  EXPECT_EQ(span.back().value(), 1);
+
+  EXPECT_TRUE(bit::words(bv.begin() + 5, bv.begin() + 5).empty());
+  EXPECT_EQ(bit::words(bv.begin() + 8, bv.begin() + 16).size(), 1);
+}
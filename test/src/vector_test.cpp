@@ -787,6 +787,15 @@ TEST(BitVectorTest, Slice) {
   EXPECT_EQ(span2[3], (0xE & (1 << 3)) ? bit::bit1 : bit::bit0);
 }
 
+TEST(BitVectorTest, Resize) {
+  bit::bit_vector<uint8_t> vec("11111111111");
+  vec.resize(3);
+  vec.resize(11);
+  EXPECT_EQ(vec, bit::bit_vector<uint8_t>("11100000000"));
+  vec.resize(20, bit::bit1);
+  EXPECT_EQ(vec, bit::bit_vector<uint8_t>("11100000000111111111"));
+}
+
 //TYPED_TEST(VectorTest, Print) {
     //std::cout << this->v3_ << std::endl;
 //}